@@ -1,23 +1,248 @@
 #ifndef Z_AKR_INTRUSIVELIST_HH
 #define Z_AKR_INTRUSIVELIST_HH
 
-#include <algorithm>
+#include <bit>
+#include <compare>
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
-#include <memory>
 #include <type_traits>
+#include <utility>
+
+// Opt-in parts with heavier standard headers: D_AKR_STATS for RecordStats<true> and RecordLatency
+// (<atomic>, <cstdio> for Dump()), D_AKR_ATOMIC_LIST for AtomicIntrusiveList (<atomic>).
+#if defined(D_AKR_STATS) || defined(D_AKR_ATOMIC_LIST)
+#include <atomic>
+#endif
+
+#ifdef  D_AKR_STATS
+#include <cstdio>
+#endif
+
+// rdtsc is a builtin on GCC / Clang, MSVC takes it (and _mm_prefetch) from <intrin.h>; elsewhere steady_clock.
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define U_AKR_RDTSC() __builtin_ia32_rdtsc()
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define U_AKR_RDTSC() __rdtsc()
+#elif defined(D_AKR_STATS)
+#include <chrono>
+#endif
+
+// USDT probes (provider "akr_intrusivelist") for bpftrace / perf, see tools/bpftrace.
+// Each probe is a single nop plus an ELF note until a tracer attaches. The probe is inline asm, so it is
+// skipped during constant evaluation.
+#if defined(D_AKR_USDT) && __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define U_AKR_PROBE(AKR_NAME, AKR_LIST, AKR_NODE, AKR_LENGTH) \
+        do \
+        { \
+            if (!std::is_constant_evaluated()) \
+            { \
+                DTRACE_PROBE3(akr_intrusivelist, AKR_NAME, AKR_LIST, AKR_NODE, AKR_LENGTH); \
+            } \
+        } \
+        while (false)
+#elif defined(D_AKR_USDT)
+// no sys/sdt.h: the arguments are still type-checked, unevaluated, so a D_AKR_USDT build catches broken probe sites
+#define U_AKR_PROBE(AKR_NAME, AKR_LIST, AKR_NODE, AKR_LENGTH) \
+        static_cast<void>(sizeof((AKR_LIST, AKR_NODE, AKR_LENGTH)))
+#else
+#define U_AKR_PROBE(AKR_NAME, AKR_LIST, AKR_NODE, AKR_LENGTH)
+#endif
+
+// MSVC ignores the standard attribute and only applies EBO to the first empty base by default.
+#if defined(_MSC_VER)
+#define U_AKR_NO_UNIQUE_ADDRESS [[msvc::no_unique_address]]
+#define U_AKR_EMPTY_BASES       __declspec(empty_bases)
+#else
+#define U_AKR_NO_UNIQUE_ADDRESS [[no_unique_address]]
+#define U_AKR_EMPTY_BASES
+#endif
+
+// Iterator and hook plumbing: forced inline so that traversal in -O0 / -Og builds costs about what
+// a raw pointer loop does, and (GCC) marked artificial so debuggers step over it.
+#ifndef U_AKR_INLINE
+#if defined(_MSC_VER) && !defined(__clang__)
+#define U_AKR_INLINE __forceinline
+#elif defined(__clang__)
+#define U_AKR_INLINE [[gnu::always_inline]] inline
+#elif defined(__GNUC__)
+#define U_AKR_INLINE [[gnu::always_inline, gnu::artificial]] inline
+#else
+#define U_AKR_INLINE inline
+#endif
+#endif
+
+// The shared link core (detail::LinkCore) is kept out of line so every IntrusiveList<T> calls one body
+// and code size stays flat with many different T. Define D_AKR_INLINE_LINK_CORE to inline it into each
+// list type again, for the hottest insert / remove loops.
+#ifndef U_AKR_LINK_CORE
+#if defined(D_AKR_INLINE_LINK_CORE)
+#define U_AKR_LINK_CORE inline
+#elif defined(_MSC_VER) && !defined(__clang__)
+#define U_AKR_LINK_CORE __declspec(noinline) inline
+#elif defined(__GNUC__) || defined(__clang__)
+#define U_AKR_LINK_CORE [[gnu::noinline]] inline
+#else
+#define U_AKR_LINK_CORE inline
+#endif
+#endif
 
 namespace akr
 {
+    template<class T>
+    struct IntrusiveNode;
+
+    namespace detail
+    {
+        template<class Member>
+        struct MemberClass
+        {
+        };
+
+        template<class M, class U>
+        struct MemberClass<M U::*>
+        {
+            using Type = U;
+        };
+
+        template<class Member>
+        struct MemberType
+        {
+        };
+
+        template<class M, class U>
+        struct MemberType<M U::*>
+        {
+            using Type = M;
+        };
+
+        // Picks the policy of the same template as Default out of Policies, Default if there is none.
+        template<class Default, class... Policies>
+        struct SelectPolicy
+        {
+            using Type = Default;
+        };
+
+        template<template<auto> class Policy, auto Default, auto Value, class... Policies>
+        struct SelectPolicy<Policy<Default>, Policy<Value>, Policies...>
+        {
+            using Type = Policy<Value>;
+        };
+
+        template<class Default, class Head, class... Policies>
+        struct SelectPolicy<Default, Head, Policies...>: SelectPolicy<Default, Policies...>
+        {
+        };
+
+        template<class Default, class... Policies>
+        using SelectPolicyT = typename SelectPolicy<Default, Policies...>::Type;
+    }
+
+    // Links T through its IntrusiveNode<T> data member instead of a base class, e.g.
+    // IntrusiveList<T, true, MemberHook<&T::hook>>. Several members let one object sit in several lists.
+    template<auto Member>
+    struct MemberHook
+    {
+        private:
+        using T = typename detail::MemberClass<decltype(Member)>::Type;
+
+        public:
+        U_AKR_INLINE static constexpr auto ToNode(T* value) noexcept -> IntrusiveNode<T>*
+        {
+            return &(value->*Member);
+        }
+    };
+
+    // Default hook: T derives from IntrusiveNode<T>.
+    template<>
+    struct MemberHook<nullptr>
+    {
+        template<class T>
+        requires(std::derived_from<T, IntrusiveNode<T>>)
+        U_AKR_INLINE static constexpr auto ToNode(T* value) noexcept -> IntrusiveNode<T>*
+        {
+            return value;
+        }
+    };
+
+    using BaseHook = MemberHook<nullptr>;
+
+    namespace detail
+    {
+        template<class... Policies>
+        using HookT = SelectPolicyT<BaseHook, Policies...>;
+
+        template<class T, class... Policies>
+        concept Hookable = requires(T* value)
+        {
+            { HookT<Policies...>::ToNode(value) } -> std::same_as<IntrusiveNode<T>*>;
+        };
+
+        // The object holding the links: T itself for BaseHook, the data member for MemberHook.
+        template<class T, class Hook>
+        struct HookNode
+        {
+            using Type = T;
+        };
+
+        template<class T, auto Member>
+        requires(Member != nullptr)
+        struct HookNode<T, MemberHook<Member>>
+        {
+            using Type = typename MemberType<decltype(Member)>::Type;
+        };
+
+        // Iterator hook of a CompactHead list, where head->prev is the tail instead of nullptr.
+        template<class Hook>
+        struct CircularHook: Hook
+        {
+        };
+
+        template<class Hook>
+        inline constexpr bool IsCircular = false;
+
+        template<class Hook>
+        inline constexpr bool IsCircular<CircularHook<Hook>> = true;
+
+        struct Empty
+        {
+        };
+    }
+
     template<class T>
     struct IntrusiveNode
     {
-        template<class U, bool>
-        requires(std::derived_from<U, IntrusiveNode<U>>)
+        template<class U, bool, class... Policies>
+        requires(detail::Hookable<U, Policies...>)
         friend struct IntrusiveList;
 
+        template<class U, bool, class... Policies>
+        requires(detail::Hookable<U, Policies...>)
+        friend struct AtomicIntrusiveList;
+
         private:
+        // The links are not part of the value: any two compare equal, so a defaulted comparison of T ignores them.
+        struct LinkPair
+        {
+            T* prev {};
+
+            T* next {};
+
+            constexpr auto operator== (const LinkPair&) const noexcept -> bool
+            {
+                return true;
+            }
+
+            constexpr auto operator<=>(const LinkPair&) const noexcept -> std::strong_ordering
+            {
+                return std::strong_ordering::equal;
+            }
+        };
+
         struct NodeIteratorBase
         {
             protected:
@@ -26,24 +251,26 @@ namespace akr
             public:
             constexpr NodeIteratorBase() = default;
 
-            constexpr NodeIteratorBase(IntrusiveNode<T>* nodePtr_) noexcept:
-                nodePtr { static_cast<T*>(nodePtr_) }
+            U_AKR_INLINE constexpr NodeIteratorBase(T* nodePtr_) noexcept:
+                nodePtr { nodePtr_ }
             {
             }
 
-            constexpr NodeIteratorBase(std::nullptr_t) noexcept:
+            U_AKR_INLINE constexpr NodeIteratorBase(std::nullptr_t) noexcept:
                 NodeIteratorBase()
             {
             }
 
             public:
-            constexpr operator bool() const noexcept
+            U_AKR_INLINE constexpr operator bool() const noexcept
             {
                 return nodePtr != nullptr;
             }
         };
 
-        template<class U, bool IsConst = false>
+        // One level of CRTP only, and every step is a direct pointer store: in -O0 builds each
+        // operator is a single forced-inline body instead of a chain of calls and temporaries.
+        template<class U, class Hook, bool IsConst = false, bool IsReverse = false>
         struct NodeIterator: NodeIteratorBase
         {
             public:
@@ -57,35 +284,42 @@ namespace akr
             using NodeIteratorBase::nodePtr;
 
             public:
-            using NodeIteratorBase::NodeIteratorBase;
+            constexpr NodeIterator() = default;
 
-            public:
-            constexpr NodeIterator(const NodeIteratorBase& iter) noexcept:
+            U_AKR_INLINE constexpr NodeIterator(T* nodePtr_) noexcept:
+                NodeIteratorBase(nodePtr_)
+            {
+            }
+
+            U_AKR_INLINE constexpr NodeIterator(std::nullptr_t) noexcept:
+                NodeIteratorBase()
+            {
+            }
+
+            U_AKR_INLINE constexpr NodeIterator(const NodeIteratorBase& iter) noexcept:
                 NodeIteratorBase(iter)
             {
             }
 
             public:
-            constexpr auto operator->() const noexcept -> pointer
+            U_AKR_INLINE constexpr auto operator->() const noexcept -> pointer
             {
                 return  nodePtr;
             }
 
-            constexpr auto operator* () const noexcept -> reference
+            U_AKR_INLINE constexpr auto operator* () const noexcept -> reference
             {
                 return *nodePtr;
             }
 
             public:
-            constexpr auto operator++(   ) noexcept -> U&
+            U_AKR_INLINE constexpr auto operator++(   ) noexcept -> U&
             {
-                auto&& rhs = *static_cast<U*>(this);
-
-                rhs.Increment();
+                nodePtr = IsReverse ? Prev() : Links()->next;
 
-                return rhs;
+                return *static_cast<U*>(this);
             }
-            constexpr auto operator++(int) noexcept -> U
+            U_AKR_INLINE constexpr auto operator++(int) noexcept -> U
             {
                 auto&& lhs = *static_cast<U*>(this);
 
@@ -96,15 +330,13 @@ namespace akr
                 return tmp;
             }
 
-            constexpr auto operator--(   ) noexcept -> U&
+            U_AKR_INLINE constexpr auto operator--(   ) noexcept -> U&
             {
-                auto&& rhs = *static_cast<U*>(this);
+                nodePtr = IsReverse ? Links()->next : Prev();
 
-                rhs.Decrement();
-
-                return rhs;
+                return *static_cast<U*>(this);
             }
-            constexpr auto operator--(int) noexcept -> U
+            U_AKR_INLINE constexpr auto operator--(int) noexcept -> U
             {
                 auto&& lhs = *static_cast<U*>(this);
 
@@ -116,191 +348,278 @@ namespace akr
             }
 
             public:
-            friend constexpr auto operator==(const U& lhs, const U& rhs) noexcept -> bool
+            U_AKR_INLINE friend constexpr auto operator==(const U& lhs, const U& rhs) noexcept -> bool
             {
                 return lhs.nodePtr == rhs.nodePtr;
             }
-            friend constexpr auto operator!=(const U& lhs, const U& rhs) noexcept -> bool
+            U_AKR_INLINE friend constexpr auto operator!=(const U& lhs, const U& rhs) noexcept -> bool
             {
                 return lhs.nodePtr != rhs.nodePtr;
             }
+
+            protected:
+            U_AKR_INLINE constexpr auto Links() const noexcept -> LinkPair*
+            {
+                return &Hook::ToNode(nodePtr)->links;
+            }
+
+            // nullptr before the head, also when the head's prev holds the tail; only the tail has no next.
+            U_AKR_INLINE constexpr auto Prev () const noexcept -> T*
+            {
+                T* prev = Links()->prev;
+
+                if constexpr (detail::IsCircular<Hook>)
+                {
+                    if (prev && !Hook::ToNode(prev)->links.next)
+                    {
+                        return nullptr;
+                    }
+                }
+
+                return prev;
+            }
         };
 
-        private:
-        template<class U, bool IsConst = false>
-        struct ForwardNodeIteratorBase: NodeIterator<U, IsConst>
+        template<class Hook>
+        struct ForwardNodeIterator      final: NodeIterator<ForwardNodeIterator<Hook>, Hook>
         {
-            template<class V, bool>
-            friend struct NodeIterator;
-
             private:
-            using NodeIterator = NodeIterator<U, IsConst>;
+            using NodeIterator = NodeIterator<ForwardNodeIterator, Hook>;
 
             public:
-            using NodeIterator::NodeIterator;
+            constexpr ForwardNodeIterator() = default;
 
-            private:
-            constexpr void Increment() noexcept
+            U_AKR_INLINE constexpr ForwardNodeIterator(T* nodePtr_) noexcept:
+                NodeIterator(nodePtr_)
+            {
+            }
+
+            U_AKR_INLINE constexpr ForwardNodeIterator(std::nullptr_t) noexcept:
+                NodeIterator(nullptr)
             {
-                *static_cast<U*>(this) = (*this)->next;
             }
 
-            constexpr void Decrement() noexcept
+            // from any other iterator over the same node, e.g. reverse from forward
+            U_AKR_INLINE constexpr ForwardNodeIterator(const NodeIteratorBase& iter) noexcept:
+                NodeIterator(iter)
             {
-                *static_cast<U*>(this) = (*this)->prev;
             }
         };
 
-        struct ForwardNodeIterator      final: ForwardNodeIteratorBase<ForwardNodeIterator>
+        template<class Hook>
+        struct ConstForwardNodeIterator final: NodeIterator<ConstForwardNodeIterator<Hook>, Hook, true>
         {
             private:
-            using ForwardNodeIteratorBase = ForwardNodeIteratorBase<ForwardNodeIterator>;
+            using NodeIterator = NodeIterator<ConstForwardNodeIterator, Hook, true>;
 
             public:
-            using ForwardNodeIteratorBase::ForwardNodeIteratorBase;
-        };
-
-        static_assert(std::bidirectional_iterator<ForwardNodeIterator>);
-        static_assert(std::equality_comparable   <ForwardNodeIterator>);
+            constexpr ConstForwardNodeIterator() = default;
 
-        struct ConstForwardNodeIterator final: ForwardNodeIteratorBase<ConstForwardNodeIterator, true>
-        {
-            private:
-            using ForwardNodeIteratorBase = ForwardNodeIteratorBase<ConstForwardNodeIterator, true>;
+            U_AKR_INLINE constexpr ConstForwardNodeIterator(T* nodePtr_) noexcept:
+                NodeIterator(nodePtr_)
+            {
+            }
 
-            public:
-            using ForwardNodeIteratorBase::ForwardNodeIteratorBase;
+            U_AKR_INLINE constexpr ConstForwardNodeIterator(std::nullptr_t) noexcept:
+                NodeIterator(nullptr)
+            {
+            }
 
-            public:
-            constexpr ConstForwardNodeIterator(const ForwardNodeIterator& iter) noexcept:
-                ForwardNodeIteratorBase(iter)
+            // from any other iterator over the same node, e.g. reverse from forward
+            U_AKR_INLINE constexpr ConstForwardNodeIterator(const NodeIteratorBase& iter) noexcept:
+                NodeIterator(iter)
             {
             }
         };
 
-        static_assert(std::bidirectional_iterator<ConstForwardNodeIterator>);
-        static_assert(std::equality_comparable   <ConstForwardNodeIterator>);
-
-        private:
-        template<class U, bool IsConst = false>
-        struct ReverseNodeIteratorBase: NodeIterator<U, IsConst>
+        template<class Hook>
+        struct ReverseNodeIterator      final: NodeIterator<ReverseNodeIterator<Hook>, Hook, false, true>
         {
-            template<class V, bool>
-            friend struct NodeIterator;
-
             private:
-            using NodeIterator = NodeIterator<U, IsConst>;
+            using NodeIterator = NodeIterator<ReverseNodeIterator, Hook, false, true>;
 
             public:
-            using NodeIterator::NodeIterator;
+            constexpr ReverseNodeIterator() = default;
 
-            private:
-            constexpr void Increment() noexcept
+            U_AKR_INLINE constexpr ReverseNodeIterator(T* nodePtr_) noexcept:
+                NodeIterator(nodePtr_)
+            {
+            }
+
+            U_AKR_INLINE constexpr ReverseNodeIterator(std::nullptr_t) noexcept:
+                NodeIterator(nullptr)
             {
-                *static_cast<U*>(this) = (*this)->prev;
             }
 
-            constexpr void Decrement() noexcept
+            // from any other iterator over the same node, e.g. reverse from forward
+            U_AKR_INLINE constexpr ReverseNodeIterator(const NodeIteratorBase& iter) noexcept:
+                NodeIterator(iter)
             {
-                *static_cast<U*>(this) = (*this)->next;
             }
         };
 
-        struct ReverseNodeIterator      final: ReverseNodeIteratorBase<ReverseNodeIterator>
+        template<class Hook>
+        struct ConstReverseNodeIterator final: NodeIterator<ConstReverseNodeIterator<Hook>, Hook, true, true>
         {
             private:
-            using ReverseNodeIteratorBase = ReverseNodeIteratorBase<ReverseNodeIterator>;
+            using NodeIterator = NodeIterator<ConstReverseNodeIterator, Hook, true, true>;
 
             public:
-            using ReverseNodeIteratorBase::ReverseNodeIteratorBase;
+            constexpr ConstReverseNodeIterator() = default;
 
-            public:
-            constexpr ReverseNodeIterator     (const ForwardNodeIterator& iter) noexcept:
-                ReverseNodeIteratorBase(iter)
+            U_AKR_INLINE constexpr ConstReverseNodeIterator(T* nodePtr_) noexcept:
+                NodeIterator(nodePtr_)
             {
             }
-        };
-
-        static_assert(std::bidirectional_iterator<ReverseNodeIterator>);
-        static_assert(std::equality_comparable   <ReverseNodeIterator>);
-
-        struct ConstReverseNodeIterator final: ReverseNodeIteratorBase<ConstReverseNodeIterator, true>
-        {
-            private:
-            using ReverseNodeIteratorBase = ReverseNodeIteratorBase<ConstReverseNodeIterator, true>;
 
-            public:
-            using ReverseNodeIteratorBase::ReverseNodeIteratorBase;
+            U_AKR_INLINE constexpr ConstReverseNodeIterator(std::nullptr_t) noexcept:
+                NodeIterator(nullptr)
+            {
+            }
 
-            public:
-            constexpr ConstReverseNodeIterator(const ForwardNodeIterator& iter) noexcept:
-                ReverseNodeIteratorBase(iter)
+            // from any other iterator over the same node, e.g. reverse from forward
+            U_AKR_INLINE constexpr ConstReverseNodeIterator(const NodeIteratorBase& iter) noexcept:
+                NodeIterator(iter)
             {
             }
         };
 
-        static_assert(std::bidirectional_iterator<ConstReverseNodeIterator>);
-        static_assert(std::equality_comparable   <ConstReverseNodeIterator>);
-
         private:
-        ForwardNodeIterator prev {};
-
-        ForwardNodeIterator next {};
+        LinkPair links {};
 
         public:
         friend auto operator<=>(const IntrusiveNode& lhs, const IntrusiveNode& rhs) = default;
+    };
+
+    // IntrusiveNode that also remembers the list it is linked into, for lists with TrackOwner<true>.
+    // Used as a base or through MemberHook like IntrusiveNode.
+    template<class T>
+    struct TrackedIntrusiveNode: IntrusiveNode<T>
+    {
+        template<class U, bool, class... Policies>
+        requires(detail::Hookable<U, Policies...>)
+        friend struct IntrusiveList;
+
+        template<class U, bool, class... Policies>
+        requires(detail::Hookable<U, Policies...>)
+        friend struct AtomicIntrusiveList;
+
+        template<class U>
+        friend struct AutoUnlinkIntrusiveNode;
 
         private:
-        constexpr void AttachPrev(ForwardNodeIterator node) noexcept
+        // Not part of the value either.
+        struct OwnerSlot
         {
-            prev = node->prev;
-            next = node;
+            void* list {};
 
-            if (node->prev)
+            constexpr auto operator== (const OwnerSlot&) const noexcept -> bool
             {
-                node->prev->next = this;
+                return true;
             }
-            node->prev = this;
-        }
-
-        constexpr void AttachNext(ForwardNodeIterator node) noexcept
-        {
-            prev = node;
-            next = node->next;
 
-            if (node->next)
+            constexpr auto operator<=>(const OwnerSlot&) const noexcept -> std::strong_ordering
             {
-                node->next->prev = this;
+                return std::strong_ordering::equal;
             }
-            node->next = this;
-        }
+        };
+
+        OwnerSlot owner {};
+
+        public:
+        friend auto operator<=>(const TrackedIntrusiveNode& lhs, const TrackedIntrusiveNode& rhs) = default;
+    };
+
+    // TrackedIntrusiveNode that unlinks itself from its list when destroyed, the list's ends and
+    // length stay right. A copy starts out unlinked.
+    template<class T>
+    struct AutoUnlinkIntrusiveNode: TrackedIntrusiveNode<T>
+    {
+        template<class U, bool, class... Policies>
+        requires(detail::Hookable<U, Policies...>)
+        friend struct IntrusiveList;
 
-        constexpr void Detach    () noexcept
+        private:
+        struct UnlinkSlot
         {
-            if (prev)
+            void (*unlink)(void* list, IntrusiveNode<T>* node) noexcept {};
+
+            constexpr auto operator== (const UnlinkSlot&) const noexcept -> bool
             {
-                prev->next = next;
+                return true;
             }
-            if (next)
+
+            constexpr auto operator<=>(const UnlinkSlot&) const noexcept -> std::strong_ordering
             {
-                next->prev = prev;
+                return std::strong_ordering::equal;
             }
+        };
+
+        UnlinkSlot unlinker {};
+
+        public:
+        constexpr AutoUnlinkIntrusiveNode() = default;
+
+        constexpr AutoUnlinkIntrusiveNode(const AutoUnlinkIntrusiveNode&) noexcept:
+            AutoUnlinkIntrusiveNode()
+        {
+        }
+
+        constexpr auto operator=(const AutoUnlinkIntrusiveNode&) noexcept -> AutoUnlinkIntrusiveNode&
+        {
+            return *this;
+        }
 
-            prev = nullptr;
-            next = nullptr;
+        constexpr ~AutoUnlinkIntrusiveNode()
+        {
+            if (this->owner.list)
+            {
+                unlinker.unlink(this->owner.list, this);
+            }
         }
+
+        public:
+        friend auto operator<=>(const AutoUnlinkIntrusiveNode& lhs, const AutoUnlinkIntrusiveNode& rhs) = default;
     };
 
+    // Policy: nodes (TrackedIntrusiveNode) record their list, which gives O(1) Contains() / OwnerOf()
+    // and lets Remove() / InsertX() unlink a node from whichever list it is in.
+    // Every list a node can enter through the hook must then be of the same IntrusiveList type.
     template<bool Enable>
+    struct TrackOwner
+    {
+    };
+
+    // Policy: only head is stored, the tail lives in head->prev (last->next stays null).
+    // An empty list is then a single pointer, for large arrays of mostly empty lists.
+    template<bool Enable>
+    struct CompactHead
+    {
+    };
+
+    // Policy: counts the length in 32 bits; together with CompactHead a counted list is 16 bytes.
+    template<bool Enable>
+    struct CompactLength
+    {
+    };
+
+    // Policy: together with RecordLength, the length is a cache that splices of an uncounted range
+    // only mark dirty, so they stay O(1); GetLength() then recounts once per dirtying.
+    template<bool Enable>
+    struct LazyLength
+    {
+    };
+
+    template<bool Enable, class Size = std::size_t, bool Lazy = false>
     struct RecordLength
     {
     };
 
-    template<>
-    struct RecordLength<true>
+    template<class Size>
+    struct RecordLength<true, Size, false>
     {
         private:
-        std::size_t length {};
+        Size length {};
 
         public:
         constexpr auto GetLength() const noexcept -> std::size_t
@@ -323,852 +642,6727 @@ namespace akr
         {
             length--;
         }
-    };
-
-    template<class T, bool Enable = true>
-    requires(std::derived_from<T, IntrusiveNode<T>>)
-    struct IntrusiveList final: RecordLength<Enable>
-    {
-        template<class U, bool>
-        requires(std::derived_from<U, IntrusiveNode<U>>)
-        friend struct IntrusiveList;
-
-        private:
-        using IntrusiveNode            = akr::IntrusiveNode<T>;
-
-        using ForwardNodeIterator      = typename IntrusiveNode::ForwardNodeIterator;
-        using ConstForwardNodeIterator = typename IntrusiveNode::ConstForwardNodeIterator;
 
-        using ReverseNodeIterator      = typename IntrusiveNode::ReverseNodeIterator;
-        using ConstReverseNodeIterator = typename IntrusiveNode::ConstReverseNodeIterator;
+        constexpr void AddLength(std::size_t n) noexcept
+        {
+            length += static_cast<Size>(n);
+        }
 
-        using RecordLength             = akr::RecordLength<Enable>;
+        constexpr void SubLength(std::size_t n) noexcept
+        {
+            length -= static_cast<Size>(n);
+        }
 
-        public:
-        static constexpr bool HasLength = Enable;
+        constexpr void SwapLength(RecordLength& other) noexcept
+        {
+            std::swap(length, other.length);
+        }
+    };
 
+    // LazyLength<true>: GetLength() is provided by IntrusiveList, a recount needs the nodes.
+    // The counter keeps being updated while dirty, its value just is not trusted until the recount.
+    template<class Size>
+    struct RecordLength<true, Size, true>
+    {
         private:
-        ForwardNodeIterator head {};
-
-        ForwardNodeIterator last {};
-
-        public:
-        constexpr IntrusiveList() = default;
-
-        public:
-        constexpr IntrusiveList  (const IntrusiveList&) = delete;
+        mutable Size length {};
+        mutable bool dirty  {};
 
-        constexpr auto operator= (const IntrusiveList&) = delete;
+        protected:
+        constexpr auto IsLengthDirty  () const noexcept -> bool
+        {
+            return dirty;
+        }
 
-        constexpr IntrusiveList  (IntrusiveList&& other) noexcept:
-            RecordLength(static_cast<RecordLength&&>(other)),
-            head { other.head },
-            last { other.last }
+        constexpr auto GetCachedLength() const noexcept -> std::size_t
         {
-            other.Clear();
+            return length;
         }
 
-        constexpr auto operator= (IntrusiveList&& other) noexcept -> IntrusiveList&
+        constexpr void SetCachedLength(std::size_t n) const noexcept
         {
-            if (this == &other)
-            {
-                return *this;
-            }
+            length = static_cast<Size>(n);
+            dirty  = false;
+        }
 
-            RecordLength::operator=(static_cast<RecordLength&&>(other));
+        constexpr void MarkLengthDirty() noexcept
+        {
+            dirty = true;
+        }
 
-            head = other.head;
-            last = other.last;
+        constexpr void SetToZero() noexcept
+        {
+            SetCachedLength(0);
+        }
 
-            other.Clear();
+        constexpr void IncLength() noexcept
+        {
+            length++;
+        }
 
-            return *this;
+        constexpr void DecLength() noexcept
+        {
+            length--;
         }
 
-        public:
-        template<class U, bool Enable_>
-        constexpr IntrusiveList  (IntrusiveList<U, Enable_>&& other) noexcept
+        constexpr void AddLength(std::size_t n) noexcept
         {
-            for (auto&& e : other)
-            {
-                InsertLast(e, other);
-            }
+            length += static_cast<Size>(n);
         }
 
-        public:
-        template<class U, bool Enable_>
-        constexpr auto operator+=(IntrusiveList<U, Enable_>&& rhs) noexcept -> IntrusiveList&
+        constexpr void SubLength(std::size_t n) noexcept
         {
-            for (decltype(rhs.begin()) iter = rhs.begin(), prev; iter != rhs.end();)
-            {
-                prev = iter++;
+            length -= static_cast<Size>(n);
+        }
 
-                InsertLast(prev, rhs);
-            }
-
-            return *this;
+        constexpr void SwapLength(RecordLength& other) noexcept
+        {
+            std::swap(length, other.length);
+            std::swap(dirty , other.dirty );
         }
+    };
+
+    // Policy: keeps an order-sensitive fingerprint of the values, so operator== rejects unequal lists in O(1)
+    // and only walks when the fingerprints match. Hash(const T&) -> std::uint64_t must agree with T's
+    // operator==, and the hashed fields must not change while the node is linked (or RefreshFingerprint()).
+    // The fingerprint is the wrapping sum of Edge(a, b) over adjacent pairs, the list ends included:
+    // one insert or remove changes two edges into one or back, range operations mark it dirty instead.
+    template<auto Hash>
+    struct Fingerprint
+    {
+        private:
+        static constexpr std::uint64_t Begin = 0x243F'6A88'85A3'08D3;
+        static constexpr std::uint64_t End   = 0x1319'8A2E'0370'7344;
+
+        mutable std::uint64_t sum   { Edge(Begin, End) };
+        mutable bool          dirty {};
 
         public:
-        template<class U, bool Enable_>
-        friend constexpr auto operator+  (IntrusiveList&& lhs, IntrusiveList<U, Enable_>&& rhs) noexcept
-            -> IntrusiveList<std::common_type_t<T, U>, Enable || Enable_>
+        // Drops the cached fingerprint after values were changed in place.
+        constexpr void RefreshFingerprint() noexcept
         {
-            IntrusiveList<std::common_type_t<T, U>, Enable || Enable_> tmp;
+            dirty = true;
+        }
 
-            for (decltype(lhs.begin()) iter = lhs.begin(), prev; iter != lhs.end();)
-            {
-                prev = iter++;
+        protected:
+        static constexpr auto Mix  (std::uint64_t x) noexcept -> std::uint64_t
+        {
+            x ^= x >> 30;
+            x *= 0xBF58'476D'1CE4'E5B9;
+            x ^= x >> 27;
+            x *= 0x94D0'49BB'1331'11EB;
+            x ^= x >> 31;
 
-                tmp.InsertLast(prev, lhs);
-            }
+            return x;
+        }
 
-            for (decltype(rhs.begin()) iter = rhs.begin(), prev; iter != rhs.end();)
-            {
-                prev = iter++;
+        static constexpr auto Edge (std::uint64_t a, std::uint64_t b) noexcept -> std::uint64_t
+        {
+            return Mix(a * 0x9E37'79B9'7F4A'7C15 + Mix(b));
+        }
 
-                tmp.InsertLast(prev, rhs);
-            }
+        // hash of a node, a missing neighbour stands for the list end on that side
+        template<class T>
+        static constexpr auto HashBefore(const T* value) noexcept -> std::uint64_t
+        {
+            return value ? static_cast<std::uint64_t>(Hash(*value)) : Begin;
+        }
 
-            return tmp;
+        template<class T>
+        static constexpr auto HashAfter (const T* value) noexcept -> std::uint64_t
+        {
+            return value ? static_cast<std::uint64_t>(Hash(*value)) : End;
         }
 
-        template<class U, bool Enable_>
-        requires(std::equality_comparable_with<T, U>)
-        friend constexpr auto operator== (const IntrusiveList& lhs, const IntrusiveList<U, Enable_>& rhs) noexcept
-            -> bool
+        constexpr auto IsFingerprintDirty  () const noexcept -> bool
         {
-            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+            return dirty;
         }
 
-        template<class U, bool Enable_>
-        requires(std::three_way_comparable_with<T, U>)
-        friend constexpr auto operator<=>(const IntrusiveList& lhs, const IntrusiveList<U, Enable_>& rhs) noexcept
+        constexpr auto GetCachedFingerprint() const noexcept -> std::uint64_t
         {
-            return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+            return sum;
         }
 
-        public:
-        constexpr auto begin     () const noexcept -> ConstForwardNodeIterator
+        // Recomputes from the first node of a chain linked through next(node).
+        template<class T, class Next>
+        constexpr void Recompute(const T* first, Next next) const noexcept
         {
-            return head;
+            sum   = 0;
+            dirty = false;
+
+            std::uint64_t prev = Begin;
+
+            for (const T* iter = first; iter; iter = next(iter))
+            {
+                auto cur = static_cast<std::uint64_t>(Hash(*iter));
+
+                sum += Edge(prev, cur);
+
+                prev = cur;
+            }
+
+            sum += Edge(prev, End);
         }
-        constexpr auto end       () const noexcept -> ConstForwardNodeIterator
+
+        constexpr void MarkFingerprintDirty() noexcept
         {
-            return nullptr;
+            dirty = true;
         }
 
-        constexpr auto rbegin    () const noexcept -> ConstReverseNodeIterator
+        constexpr void ResetFingerprint() noexcept
         {
-            return last;
+            sum   = Edge(Begin, End);
+            dirty = false;
         }
-        constexpr auto rend      () const noexcept -> ConstReverseNodeIterator
+
+        constexpr void OnLinkFingerprint  (std::uint64_t prev, std::uint64_t node, std::uint64_t next) noexcept
         {
-            return nullptr;
+            sum += Edge(prev, node) + Edge(node, next) - Edge(prev, next);
         }
 
-        constexpr auto cbegin    () const noexcept -> ConstForwardNodeIterator
+        constexpr void OnUnlinkFingerprint(std::uint64_t prev, std::uint64_t node, std::uint64_t next) noexcept
         {
-            return head;
+            sum -= Edge(prev, node) + Edge(node, next) - Edge(prev, next);
+        }
+
+        // first..tail became newFirst..newTail by closing the ring and cutting it before newFirst
+        constexpr void OnRotateFingerprint(std::uint64_t first, std::uint64_t tail, std::uint64_t newFirst, std::uint64_t newTail) noexcept
+        {
+            sum += Edge(tail , first   ) + Edge(Begin, newFirst) + Edge(newTail, End)
+                 - Edge(Begin, first   ) - Edge(tail , End     ) - Edge(newTail, newFirst);
         }
-        constexpr auto cend      () const noexcept -> ConstForwardNodeIterator
+
+        constexpr void SwapFingerprint(Fingerprint& other) noexcept
         {
-            return nullptr;
+            std::swap(sum  , other.sum  );
+            std::swap(dirty, other.dirty);
         }
+    };
+
+    template<>
+    struct Fingerprint<nullptr>
+    {
+    };
+
+#ifdef  D_AKR_STATS
+    struct ListStats
+    {
+        std::size_t inserts   {};
+        std::size_t removes   {};
+        std::size_t splices   {};
+        std::size_t highWater {};
+        std::size_t visited   {};
+    };
+
+    template<bool Enable>
+    struct RecordStats
+    {
+    };
+
+    // Per-list counters with a single writer: only the thread that owns the list updates them, with a
+    // relaxed load + store instead of a read-modify-write; the atomics just make GetStats() from a
+    // monitoring thread race-free. Per-thread totals are the sum of GetStats() over the lists a thread owns.
+    // highWater is taken from the list's own length, so it only moves while that is known: with
+    // RecordLength, and not while a LazyLength is dirty.
+    template<>
+    struct RecordStats<true>
+    {
+        private:
+        mutable std::atomic<std::size_t> inserts   {};
+        mutable std::atomic<std::size_t> removes   {};
+        mutable std::atomic<std::size_t> splices   {};
+        mutable std::atomic<std::size_t> highWater {};
+        mutable std::atomic<std::size_t> visited   {};
 
-        constexpr auto crbegin   () const noexcept -> ConstReverseNodeIterator
+        public:
+        constexpr RecordStats() = default;
+
+        RecordStats  (RecordStats&& other) noexcept
         {
-            return last;
+            Assign(other);
         }
-        constexpr auto crend     () const noexcept -> ConstReverseNodeIterator
+
+        auto operator= (RecordStats&& other) noexcept -> RecordStats&
         {
-            return nullptr;
+            if (this != &other)
+            {
+                Assign(other);
+            }
+
+            return *this;
         }
 
         public:
-        constexpr auto begin     ()       noexcept -> ForwardNodeIterator
+        auto GetStats () const noexcept -> ListStats
         {
-            return head;
+            return
+            {
+                inserts  .load(std::memory_order_relaxed),
+                removes  .load(std::memory_order_relaxed),
+                splices  .load(std::memory_order_relaxed),
+                highWater.load(std::memory_order_relaxed),
+                visited  .load(std::memory_order_relaxed),
+            };
         }
-        constexpr auto end       ()       noexcept -> ForwardNodeIterator
+
+        protected:
+        // A length the list does not know without a walk.
+        static constexpr std::size_t UnknownLength = static_cast<std::size_t>(-1);
+
+        void ResetStats(std::size_t length) noexcept
         {
-            return nullptr;
+            inserts  .store(0, std::memory_order_relaxed);
+            removes  .store(0, std::memory_order_relaxed);
+            splices  .store(0, std::memory_order_relaxed);
+            visited  .store(0, std::memory_order_relaxed);
+            highWater.store(length == UnknownLength ? 0 : length, std::memory_order_relaxed);
         }
 
-        constexpr auto rbegin    ()       noexcept -> ReverseNodeIterator
+        // length is the list's length after the insert, or UnknownLength.
+        void OnInsert(std::size_t n, std::size_t length) const noexcept
         {
-            return last;
+            Bump(inserts, n);
+
+            if (length != UnknownLength && length > highWater.load(std::memory_order_relaxed))
+            {
+                highWater.store(length, std::memory_order_relaxed);
+            }
         }
-        constexpr auto rend      ()       noexcept -> ReverseNodeIterator
+
+        void OnRemove(std::size_t n = 1) const noexcept
         {
-            return nullptr;
+            Bump(removes, n);
         }
 
-        public:
-        constexpr auto GetHead   () const noexcept -> ForwardNodeIterator
+        void OnSplice() const noexcept
         {
-            return head;
+            Bump(splices, 1);
         }
 
-        constexpr auto GetLast   () const noexcept -> ForwardNodeIterator
+        void OnVisit (std::size_t n = 1) const noexcept
         {
-            return last;
+            Bump(visited, n);
         }
 
-        constexpr auto IsEmpty   () const noexcept -> bool
+        private:
+        static void Bump(std::atomic<std::size_t>& counter, std::size_t n) noexcept
         {
-            return !head && !last;
+            counter.store(counter.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
         }
 
-        public:
-        constexpr void Clear     () noexcept
+        void Assign(const RecordStats& other) noexcept
         {
-            last = head = nullptr;
+            inserts  .store(other.inserts  .load(std::memory_order_relaxed), std::memory_order_relaxed);
+            removes  .store(other.removes  .load(std::memory_order_relaxed), std::memory_order_relaxed);
+            splices  .store(other.splices  .load(std::memory_order_relaxed), std::memory_order_relaxed);
+            highWater.store(other.highWater.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            visited  .store(other.visited  .load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    };
 
-            if constexpr (Enable)
+    // Log-linear (HDR-style) histogram: values below 2^SubBits are exact, above that every power of two
+    // is split into 2^SubBits buckets. Record() and Merge() are lock-free, so one histogram may be fed by
+    // many threads, or per-thread histograms may be merged into one when dumping.
+    struct LatencyHistogram
+    {
+        private:
+        static constexpr std::size_t SubBits  = 3;
+        static constexpr std::size_t SubCount = std::size_t { 1 } << SubBits;
+
+        public:
+        static constexpr std::size_t BucketCount = (64 - SubBits + 1) * SubCount;
+
+        private:
+        std::atomic<std::uint64_t> counts[BucketCount] {};
+
+        public:
+        static constexpr auto GetBucket    (std::uint64_t value) noexcept -> std::size_t
+        {
+            if (value < SubCount)
             {
-                RecordLength::SetToZero();
+                return static_cast<std::size_t>(value);
             }
+
+            auto msb = static_cast<std::size_t>(std::bit_width(value)) - 1;
+
+            return (msb - SubBits + 1) * SubCount + static_cast<std::size_t>((value >> (msb - SubBits)) & (SubCount - 1));
         }
 
-        constexpr auto InsertPrev(ForwardNodeIterator curNode, ForwardNodeIterator newNode) noexcept
-            -> ForwardNodeIterator
+        static constexpr auto GetLowerBound(std::size_t bucket) noexcept -> std::uint64_t
         {
-            newNode->Detach();
-
-            if (IsEmpty())
+            if (bucket < SubCount)
             {
-                head = newNode;
-                last = newNode;
+                return bucket;
             }
-            else
+
+            return (SubCount + bucket % SubCount) << (bucket / SubCount - 1);
+        }
+
+        static constexpr auto GetUpperBound(std::size_t bucket) noexcept -> std::uint64_t
+        {
+            if (bucket < SubCount)
             {
-                newNode->AttachPrev(curNode);
+                return bucket;
+            }
+
+            return GetLowerBound(bucket) + ((std::uint64_t { 1 } << (bucket / SubCount - 1)) - 1);
+        }
+
+        public:
+        void Record (std::uint64_t value, std::uint64_t count = 1) noexcept
+        {
+            counts[GetBucket(value)].fetch_add(count, std::memory_order_relaxed);
+        }
 
-                if (curNode == head)
+        void Merge  (const LatencyHistogram& other) noexcept
+        {
+            for (std::size_t i = 0; i < BucketCount; i++)
+            {
+                if (auto count = other.counts[i].load(std::memory_order_relaxed))
                 {
-                    head = newNode;
+                    counts[i].fetch_add(count, std::memory_order_relaxed);
                 }
             }
+        }
 
-            if constexpr (Enable)
+        void Reset  () noexcept
+        {
+            for (auto&& e : counts)
             {
-                RecordLength::IncLength();
+                e.store(0, std::memory_order_relaxed);
             }
-
-            return newNode;
         }
 
-        constexpr auto InsertNext(ForwardNodeIterator curNode, ForwardNodeIterator newNode) noexcept
-            -> ForwardNodeIterator
+        auto GetCount() const noexcept -> std::uint64_t
         {
-            newNode->Detach();
+            std::uint64_t total {};
 
-            if (IsEmpty())
+            for (auto&& e : counts)
             {
-                head = newNode;
-                last = newNode;
+                total += e.load(std::memory_order_relaxed);
             }
-            else
+
+            return total;
+        }
+
+        // Upper bound of the bucket holding the given percentile (0 - 100), 0 if nothing was recorded.
+        auto GetPercentile(double percentile) const noexcept -> std::uint64_t
+        {
+            auto total  = GetCount();
+            auto target = static_cast<std::uint64_t>(static_cast<double>(total) * percentile / 100.0);
+
+            std::uint64_t seen {};
+
+            for (std::size_t i = 0; i < BucketCount; i++)
             {
-                newNode->AttachNext(curNode);
+                seen += counts[i].load(std::memory_order_relaxed);
 
-                if (curNode == last)
+                if (seen && seen >= target)
                 {
-                    last = newNode;
+                    return GetUpperBound(i);
                 }
             }
 
-            if constexpr (Enable)
+            return 0;
+        }
+
+        void Dump   (std::FILE* file, const char* name = "") const noexcept
+        {
+            std::fprintf(file, "%s: count %llu p50 %llu p99 %llu p99.9 %llu\n", name,
+                         static_cast<unsigned long long>(GetCount()),
+                         static_cast<unsigned long long>(GetPercentile(50.0)),
+                         static_cast<unsigned long long>(GetPercentile(99.0)),
+                         static_cast<unsigned long long>(GetPercentile(99.9)));
+
+            for (std::size_t i = 0; i < BucketCount; i++)
             {
-                RecordLength::IncLength();
+                if (auto count = counts[i].load(std::memory_order_relaxed))
+                {
+                    std::fprintf(file, "  [%llu, %llu] %llu\n",
+                                 static_cast<unsigned long long>(GetLowerBound(i)),
+                                 static_cast<unsigned long long>(GetUpperBound(i)),
+                                 static_cast<unsigned long long>(count));
+                }
             }
-
-            return newNode;
         }
+    };
 
-        constexpr auto InsertHead(ForwardNodeIterator newNode) noexcept -> ForwardNodeIterator
+    struct ListLatency
+    {
+        LatencyHistogram insert;
+        LatencyHistogram remove;
+        LatencyHistogram traverse;
+
+        void Merge(const ListLatency& other) noexcept
         {
-            return InsertPrev(head, newNode);
+            insert  .Merge(other.insert  );
+            remove  .Merge(other.remove  );
+            traverse.Merge(other.traverse);
         }
 
-        constexpr auto InsertLast(ForwardNodeIterator newNode) noexcept -> ForwardNodeIterator
+        void Reset() noexcept
         {
-            return InsertNext(last, newNode);
+            insert  .Reset();
+            remove  .Reset();
+            traverse.Reset();
         }
 
-        template<class U, bool Enable_>
-        constexpr auto InsertPrev(ForwardNodeIterator curNode, ForwardNodeIterator newNode,
-                                  IntrusiveList<U, Enable_>& other) noexcept -> ForwardNodeIterator
+        void Dump (std::FILE* file) const noexcept
         {
-            other.Remove(newNode);
-
-            return InsertPrev(curNode, newNode);
+            insert  .Dump(file, "insert"  );
+            remove  .Dump(file, "remove"  );
+            traverse.Dump(file, "traverse");
         }
+    };
 
-        template<class U, bool Enable_>
-        constexpr auto InsertNext(ForwardNodeIterator curNode, ForwardNodeIterator newNode,
-                                  IntrusiveList<U, Enable_>& other) noexcept -> ForwardNodeIterator
-        {
-            other.Remove(newNode);
+    // rdtsc where available, steady_clock (clock_gettime / QueryPerformanceCounter) elsewhere.
+    inline auto ReadTicks() noexcept -> std::uint64_t
+    {
+#ifdef  U_AKR_RDTSC
+        return U_AKR_RDTSC();
+#else
+        return static_cast<std::uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    // Samples one in SampleEvery operations into the attached ListLatency; 0 compiles to nothing.
+    template<std::size_t SampleEvery>
+    struct RecordLatency
+    {
+        private:
+        ListLatency* sink      {};
 
-            return InsertNext(curNode, newNode);
-        }
+        std::size_t  countdown { SampleEvery };
 
-        template<class U, bool Enable_>
-        constexpr auto InsertHead(ForwardNodeIterator newNode,
-                                  IntrusiveList<U, Enable_>& other) noexcept -> ForwardNodeIterator
+        public:
+        struct TraversalSample
         {
-            other.Remove(newNode);
+            private:
+            ListLatency*  sink  {};
+
+            std::uint64_t start {};
+
+            public:
+            TraversalSample(ListLatency* sink_, std::uint64_t start_) noexcept:
+                sink  { sink_  },
+                start { start_ }
+            {
+            }
+
+            TraversalSample(const TraversalSample&) = delete;
+
+            ~TraversalSample()
+            {
+                if (start)
+                {
+                    sink->traverse.Record(ReadTicks() - start);
+                }
+            }
+        };
 
-            return InsertHead(newNode);
+        public:
+        void SetLatencySink(ListLatency* sink_) noexcept
+        {
+            sink = sink_;
         }
 
-        template<class U, bool Enable_>
-        constexpr auto InsertLast(ForwardNodeIterator newNode,
-                                  IntrusiveList<U, Enable_>& other) noexcept -> ForwardNodeIterator
+        auto GetLatencySink() const noexcept -> ListLatency*
         {
-            other.Remove(newNode);
+            return sink;
+        }
 
-            return InsertLast(newNode);
+        // Scope guard timing a caller's traversal segment, subject to the same 1-in-N sampling.
+        auto SampleTraversal() noexcept -> TraversalSample
+        {
+            return { sink, BeginSample() };
         }
 
-        constexpr void Remove    (ForwardNodeIterator curNode) noexcept
+        protected:
+        auto BeginSample() noexcept -> std::uint64_t
         {
-            if (curNode == head)
-            {
-                ++head;
-            }
-            if (curNode == last)
+            if (!sink || --countdown)
             {
-                --last;
+                return 0;
             }
 
-            curNode->Detach();
+            countdown = SampleEvery;
 
-            if constexpr (Enable)
-            {
-                RecordLength::DecLength();
-            }
+            return ReadTicks();
         }
 
-        constexpr void RemoveHead() noexcept
+        void EndInsert  (std::uint64_t start) const noexcept
         {
-            Remove(head);
+            EndSample(start, &ListLatency::insert);
         }
 
-        constexpr void RemoveLast() noexcept
+        void EndRemove  (std::uint64_t start) const noexcept
+        {
+            EndSample(start, &ListLatency::remove);
+        }
+
+        private:
+        void EndSample  (std::uint64_t start, LatencyHistogram ListLatency::* histogram) const noexcept
         {
-            Remove(last);
+            if (start)
+            {
+                (sink->*histogram).Record(ReadTicks() - start);
+            }
         }
     };
-}
 
-#ifdef  D_AKR_TEST
-#include <vector>
+#else
+    template<bool Enable>
+    struct RecordStats
+    {
+        static_assert(!Enable, "RecordStats<true> needs D_AKR_STATS");
+    };
 
-namespace akr::test
-{
-    AKR_TEST(IntrusiveList,
+    template<std::size_t SampleEvery>
+    struct RecordLatency
     {
-        struct Test: IntrusiveNode<Test>
+        static_assert(SampleEvery == 0, "RecordLatency needs D_AKR_STATS");
+    };
+#endif//D_AKR_STATS
+
+    template<>
+    struct RecordLatency<0>
+    {
+    };
+
+    namespace detail
+    {
+        template<class... Policies>
+        using LengthT = std::conditional_t<std::same_as<SelectPolicyT<CompactLength<false>, Policies...>, CompactLength<true>>,
+                                           std::uint32_t, std::size_t>;
+
+        template<class... Policies>
+        inline constexpr bool IsLazyLength = std::same_as<SelectPolicyT<LazyLength<false>, Policies...>, LazyLength<true>>;
+
+        // Pointer surgery shared by every IntrusiveList<T, ...>, so hundreds of list types do not each carry
+        // their own copy. A node is a void* plus the byte offset of its LinkPair. The T* slots of LinkPair and
+        // of the list ends are only copied in and out with memcpy, never read through a void* lvalue, which
+        // keeps the core within the aliasing rules; all supported compilers give T* and void* the same
+        // representation. Only the run-time path comes here, constant evaluation stays on the typed code.
+        struct LinkCore
         {
-            int value {};
+            // The list's head and last slots; last is nullptr for CompactHead, whose tail lives in head->prev.
+            struct Ends
+            {
+                void* head;
+                void* last;
+            };
 
-            Test(int value_) noexcept:
-                value { value_ }
+            U_AKR_INLINE static auto Load (const void* slot) noexcept -> void*
             {
+                void* value;
+
+                std::memcpy(&value, slot, sizeof(value));
+
+                return value;
             }
 
-            auto operator<=>(const Test&) const = default;
-        };
+            U_AKR_INLINE static void Store(void* slot, void* value) noexcept
+            {
+                std::memcpy(slot, &value, sizeof(value));
+            }
 
-        IntrusiveList<Test> list;
-        std::vector  <Test*> vec;
+            U_AKR_INLINE static auto GetPrev(void* node, std::ptrdiff_t offset) noexcept -> void*
+            {
+                return Load(static_cast<char*>(node) + offset);
+            }
 
-        assert(list.IsEmpty());
-        assert(list.GetLength() == 0);
+            U_AKR_INLINE static auto GetNext(void* node, std::ptrdiff_t offset) noexcept -> void*
+            {
+                return Load(static_cast<char*>(node) + offset + sizeof(void*));
+            }
 
-        auto p = list.GetHead();
-        assert(!p);
+            U_AKR_INLINE static void SetPrev(void* node, std::ptrdiff_t offset, void* value) noexcept
+            {
+                Store(static_cast<char*>(node) + offset, value);
+            }
 
-        auto v1 = Test(1);
-        auto v2 = Test(2);
-        auto v3 = Test(3);
+            U_AKR_INLINE static void SetNext(void* node, std::ptrdiff_t offset, void* value) noexcept
+            {
+                Store(static_cast<char*>(node) + offset + sizeof(void*), value);
+            }
 
-        list.InsertLast(&v1);
-        list.InsertLast(&v2);
-        list.InsertLast(&v3);
+            U_AKR_LINK_CORE static void InsertPrev(Ends ends, void* cur, void* node, std::ptrdiff_t offset) noexcept
+            {
+                void* head = Load(ends.head);
 
-        assert(list.IsEmpty() == false);
-        assert(list.GetLength() == 3);
+                if (!head)
+                {
+                    SetPrev(node, offset, ends.last ? nullptr : node);
+                    SetNext(node, offset, nullptr);
 
-        assert(list.GetHead() == &v1);
-        assert(list.GetLast() == &v3);
+                    Store(ends.head, node);
 
-        p = list.GetHead();
-        vec.push_back(&*p);
-        assert(p == &v1);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v2);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v3);
+                    if (ends.last)
+                    {
+                        Store(ends.last, node);
+                    }
 
-        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+                    return;
+                }
 
-        vec.clear();
+                void* prev = cur == head ? nullptr : GetPrev(cur , offset);
+                void* tail = ends.last   ? nullptr : GetPrev(head, offset);
 
-        list.Remove(&v2);
+                SetNext(node, offset, cur );
+                SetPrev(cur , offset, node);
 
-        assert(list.IsEmpty() == false);
-        assert(list.GetLength() == 2);
+                if (prev)
+                {
+                    SetPrev(node, offset, prev);
+                    SetNext(prev, offset, node);
+                }
+                else
+                {
+                    // new head, with CompactHead it takes over the tail
+                    SetPrev(node, offset, tail);
 
-        assert(list.GetHead() == &v1);
-        assert(list.GetLast() == &v3);
+                    Store(ends.head, node);
+                }
+            }
 
-        p = list.GetHead();
-        vec.push_back(&*p);
-        assert(p == &v1);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v3);
+            U_AKR_LINK_CORE static void InsertNext(Ends ends, void* cur, void* node, std::ptrdiff_t offset) noexcept
+            {
+                void* head = Load(ends.head);
 
-        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+                if (!head)
+                {
+                    InsertPrev(ends, nullptr, node, offset);
 
-        vec.clear();
+                    return;
+                }
 
-        auto v4 = Test(4);
-        auto v5 = Test(5);
+                void* next = GetNext(cur, offset);
 
-        list.InsertPrev(list.GetHead(), &v4);
-        list.InsertPrev(list.GetLast(), &v5);
+                SetPrev(node, offset, cur );
+                SetNext(node, offset, next);
+                SetNext(cur , offset, node);
 
-        assert(list.IsEmpty() == false);
-        assert(list.GetLength() == 4);
+                if (next)
+                {
+                    SetPrev(next, offset, node);
+                }
+                else if (ends.last)
+                {
+                    Store(ends.last, node);
+                }
+                else
+                {
+                    SetPrev(head, offset, node);
+                }
+            }
 
-        assert(list.GetHead() == &v4);
-        assert(list.GetLast() == &v3);
+            U_AKR_LINK_CORE static void Unlink(Ends ends, void* node, std::ptrdiff_t offset) noexcept
+            {
+                void* head = Load(ends.head);
+                void* prev = node == head ? nullptr : GetPrev(node, offset);
+                void* next = GetNext(node, offset);
+                void* tail = ends.last ? Load(ends.last) : GetPrev(head, offset);
 
-        p = list.GetHead();
-        vec.push_back(&*p);
-        assert(p == &v4);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v1);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v5);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v3);
+                if (prev)
+                {
+                    SetNext(prev, offset, next);
+                }
+                if (next)
+                {
+                    SetPrev(next, offset, prev);
+                }
 
-        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+                head = node == head ? next : head;
+                tail = node == tail ? prev : tail;
 
-        vec.clear();
+                Store(ends.head, head);
 
-        list.RemoveHead();
-        list.RemoveLast();
+                if (ends.last)
+                {
+                    Store(ends.last, tail);
+                }
+                else if (head)
+                {
+                    SetPrev(head, offset, tail);
+                }
+            }
 
-        assert(list.IsEmpty() == false);
-        assert(list.GetLength() == 2);
+            // Fixes the neighbours and clears node's links; node must not be the head of a CompactHead list.
+            U_AKR_LINK_CORE static void Detach(void* node, std::ptrdiff_t offset) noexcept
+            {
+                void* prev = GetPrev(node, offset);
+                void* next = GetNext(node, offset);
 
-        assert(list.GetHead() == &v1);
-        assert(list.GetLast() == &v5);
+                if (prev)
+                {
+                    SetNext(prev, offset, next);
+                }
+                if (next)
+                {
+                    SetPrev(next, offset, prev);
+                }
 
-        auto v6 = Test(6);
-        auto v7 = Test(7);
+                SetPrev(node, offset, nullptr);
+                SetNext(node, offset, nullptr);
+            }
+        };
 
-        list.InsertNext(list.GetHead(), &v6);
-        list.InsertNext(list.GetLast(), &v7);
+        constexpr void Prefetch(const void* ptr) noexcept
+        {
+            if (std::is_constant_evaluated() || !ptr)
+            {
+                return;
+            }
 
-        assert(list.IsEmpty() == false);
-        assert(list.GetLength() == 4);
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(ptr);
+#elif defined(_M_X64) || defined(_M_IX86)
+            _mm_prefetch(static_cast<const char*>(ptr), _MM_HINT_T0);
+#endif
+        }
+    }
+
+    template<class T, bool Enable = true, class... Policies>
+    requires(detail::Hookable<T, Policies...>)
+    struct U_AKR_EMPTY_BASES IntrusiveList final: RecordLength<Enable, detail::LengthT<Policies...>, Enable && detail::IsLazyLength<Policies...>>,
+                                                  detail::SelectPolicyT<RecordStats  <false>, Policies...>,
+                                                  detail::SelectPolicyT<RecordLatency<0    >, Policies...>,
+                                                  detail::SelectPolicyT<Fingerprint  <nullptr>, Policies...>
+    {
+        template<class U, bool, class... Policies_>
+        requires(detail::Hookable<U, Policies_...>)
+        friend struct IntrusiveList;
 
-        assert(list.GetHead() == &v1);
-        assert(list.GetLast() == &v7);
+        template<class U, bool, class... Policies_>
+        requires(detail::Hookable<U, Policies_...>)
+        friend struct AtomicIntrusiveList;
 
-        p = list.GetHead();
-        vec.push_back(&*p);
-        assert(p == &v1);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v6);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v5);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v7);
+        private:
+        using IntrusiveNode            = akr::IntrusiveNode<T>;
 
-        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+        using Hook                     = detail::HookT<Policies...>;
 
-        list.Clear();
-        assert(list.IsEmpty());
-        assert(list.GetLength() == 0);
+        public:
+        static constexpr bool HasCompactHead = std::same_as<detail::SelectPolicyT<CompactHead<false>, Policies...>, CompactHead<true>>;
 
-        vec.clear();
+        private:
+        static constexpr bool IsAutoUnlink   = std::derived_from<typename detail::HookNode<T, Hook>::Type, AutoUnlinkIntrusiveNode<T>>;
 
-        auto v8 = Test(8);
-        auto v9 = Test(9);
-        auto v0 = Test(0);
+        public:
+        // auto-unlink needs the owner to fix the ends, so it turns TrackOwner on unless given TrackOwner<false>
+        static constexpr bool HasOwner       = std::same_as<detail::SelectPolicyT<TrackOwner<IsAutoUnlink>, Policies...>, TrackOwner<true>>;
 
-        list.InsertHead(&v8);
-        list.InsertHead(&v9);
-        list.InsertHead(&v0);
+        static constexpr bool HasAutoUnlink  = IsAutoUnlink && HasOwner;
 
-        assert(list.IsEmpty() == false);
-        assert(list.GetLength() == 3);
+        static_assert(!HasOwner || std::derived_from<typename detail::HookNode<T, Hook>::Type, TrackedIntrusiveNode<T>>,
+                      "TrackOwner<true> needs the hook to be a TrackedIntrusiveNode<T>");
 
-        assert(list.GetHead() == &v0);
-        assert(list.GetLast() == &v8);
+        private:
+        using IterHook                 = std::conditional_t<HasCompactHead, detail::CircularHook<Hook>, Hook>;
 
-        p = list.GetHead();
-        vec.push_back(&*p);
-        assert(p == &v0);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v9);
-        ++p;
-        vec.push_back(&*p);
-        assert(p == &v8);
+        using ForwardNodeIterator      = typename IntrusiveNode::template ForwardNodeIterator     <IterHook>;
+        using ConstForwardNodeIterator = typename IntrusiveNode::template ConstForwardNodeIterator<IterHook>;
 
-        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+        using ReverseNodeIterator      = typename IntrusiveNode::template ReverseNodeIterator     <IterHook>;
+        using ConstReverseNodeIterator = typename IntrusiveNode::template ConstReverseNodeIterator<IterHook>;
 
-        vec.clear();
+        static_assert(std::bidirectional_iterator<ForwardNodeIterator     >);
+        static_assert(std::bidirectional_iterator<ConstForwardNodeIterator>);
+        static_assert(std::bidirectional_iterator<ReverseNodeIterator     >);
+        static_assert(std::bidirectional_iterator<ConstReverseNodeIterator>);
 
-        IntrusiveList<Test> list1;
-        std::vector  <Test*> vec1;
+        public:
+        static constexpr bool HasLength     = Enable;
 
-        IntrusiveList<Test> list2;
-        std::vector  <Test*> vec2;
+        static constexpr bool HasLazyLength = Enable && detail::IsLazyLength<Policies...>;
 
-        assert(list1 == list2);
+        private:
+        using RecordLength             = akr::RecordLength<Enable, detail::LengthT<Policies...>, HasLazyLength>;
 
-        list1.InsertLast(&v1);
-        list1.InsertLast(&v2);
-        list1.InsertLast(&v3);
-        list1.InsertLast(&v4);
-        list1.InsertLast(&v5);
+        private:
+        using RecordStats              = detail::SelectPolicyT<akr::RecordStats  <false>, Policies...>;
 
-        list2.InsertLast(&v6);
-        list2.InsertLast(&v7);
-        list2.InsertLast(&v8);
-        list2.InsertLast(&v9);
-        list2.InsertLast(&v0);
+        using RecordLatency            = detail::SelectPolicyT<akr::RecordLatency<0    >, Policies...>;
 
-        list1.InsertPrev(&v2, &v9, list2);
-        list1.InsertLast(&v8, list2);
+        public:
+        static constexpr bool HasStats   = std::same_as<RecordStats, akr::RecordStats<true>>;
 
-        assert(list1.IsEmpty() == false);
-        assert(list1.GetLength() == 7);
+        static constexpr bool HasLatency = !std::same_as<RecordLatency, akr::RecordLatency<0>>;
 
-        assert(list2.IsEmpty() == false);
-        assert(list2.GetLength() == 3);
+        private:
+        using Fingerprint              = detail::SelectPolicyT<akr::Fingerprint<nullptr>, Policies...>;
 
-        assert(list1 != list2);
-        assert(list1 <  list2);
-        assert(list1 <= list2);
+        public:
+        static constexpr bool HasFingerprint = !std::same_as<Fingerprint, akr::Fingerprint<nullptr>>;
 
-        vec1.push_back  (&v1);
-        vec1.push_back  (&v9);
-        vec1.push_back  (&v2);
-        vec1.push_back  (&v3);
-        vec1.push_back  (&v4);
-        vec1.push_back  (&v5);
-        vec1.push_back  (&v8);
+        private:
+        T* head {};
 
-        vec2.push_back  (&v6);
+        U_AKR_NO_UNIQUE_ADDRESS std::conditional_t<HasCompactHead, detail::Empty, T*> last {};
+
+        public:
+        constexpr IntrusiveList() = default;
+
+        public:
+        constexpr IntrusiveList  (const IntrusiveList&) = delete;
+
+        constexpr auto operator= (const IntrusiveList&) = delete;
+
+        constexpr IntrusiveList  (IntrusiveList&& other) noexcept:
+            RecordLength(static_cast<RecordLength&&>(other)),
+            RecordStats (static_cast<RecordStats &&>(other)),
+            RecordLatency(static_cast<RecordLatency&&>(other)),
+            Fingerprint  (static_cast<Fingerprint  &&>(other)),
+            head { other.head },
+            last { other.last }
+        {
+            other.Forget();
+
+            OwnAll();
+        }
+
+        constexpr ~IntrusiveList() requires(!HasOwner) = default;
+
+        // the nodes must not point at a dead list when they are inserted, removed or destroyed later
+        constexpr ~IntrusiveList() requires( HasOwner)
+        {
+            Clear();
+        }
+
+        constexpr auto operator= (IntrusiveList&& other) noexcept -> IntrusiveList&
+        {
+            if (this == &other)
+            {
+                return *this;
+            }
+
+            // the old nodes must not keep pointing here
+            if constexpr (HasOwner)
+            {
+                Clear();
+            }
+
+            RecordLength::operator=(static_cast<RecordLength&&>(other));
+            RecordStats ::operator=(static_cast<RecordStats &&>(other));
+            RecordLatency::operator=(static_cast<RecordLatency&&>(other));
+            Fingerprint  ::operator=(static_cast<Fingerprint  &&>(other));
+
+            head = other.head;
+            last = other.last;
+
+            other.Forget();
+
+            OwnAll();
+
+            return *this;
+        }
+
+        public:
+        template<class U, bool Enable_, class... Policies_>
+        constexpr IntrusiveList  (IntrusiveList<U, Enable_, Policies_...>&& other) noexcept
+        {
+            for (decltype(other.begin()) iter = other.begin(), prev; iter != other.end();)
+            {
+                prev = iter++;
+
+                if constexpr (HasStats)
+                {
+                    RecordStats::OnVisit();
+                }
+
+                InsertLast(prev.operator->(), other);
+            }
+        }
+
+        public:
+        template<class U, bool Enable_, class... Policies_>
+        constexpr auto operator+=(IntrusiveList<U, Enable_, Policies_...>&& rhs) noexcept -> IntrusiveList&
+        {
+            for (decltype(rhs.begin()) iter = rhs.begin(), prev; iter != rhs.end();)
+            {
+                prev = iter++;
+
+                if constexpr (HasStats)
+                {
+                    RecordStats::OnVisit();
+                }
+
+                Take(rhs, prev.operator->());
+
+                LinkNext(GetTail(), prev.operator->());
+            }
+
+            // one probe for the whole merge
+            U_AKR_PROBE(merge, this, &rhs, ProbeLength());
+
+            return *this;
+        }
+
+        public:
+        template<class U, bool Enable_, class... Policies_>
+        friend constexpr auto operator+  (IntrusiveList&& lhs, IntrusiveList<U, Enable_, Policies_...>&& rhs) noexcept
+            -> IntrusiveList<std::common_type_t<T, U>, Enable || Enable_, Policies...>
+        {
+            IntrusiveList<std::common_type_t<T, U>, Enable || Enable_, Policies...> tmp;
+
+            for (decltype(lhs.begin()) iter = lhs.begin(), prev; iter != lhs.end();)
+            {
+                prev = iter++;
+
+                tmp.InsertLast(prev.operator->(), lhs);
+            }
+
+            for (decltype(rhs.begin()) iter = rhs.begin(), prev; iter != rhs.end();)
+            {
+                prev = iter++;
+
+                tmp.InsertLast(prev.operator->(), rhs);
+            }
+
+            return tmp;
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        requires(std::equality_comparable_with<T, U>)
+        friend constexpr auto operator== (const IntrusiveList& lhs, const IntrusiveList<U, Enable_, Policies_...>& rhs) noexcept
+            -> bool
+        {
+            // the O(1) rejections need both sides to agree on what they record
+            if constexpr (std::same_as<IntrusiveList, IntrusiveList<U, Enable_, Policies_...>>)
+            {
+                if (auto l = lhs.KnownLength(), r = rhs.KnownLength(); l != Uncounted && r != Uncounted && l != r)
+                {
+                    return false;
+                }
+
+                if constexpr (HasFingerprint)
+                {
+                    if (lhs.GetFingerprint() != rhs.GetFingerprint())
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            return lhs.Equal(rhs);
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        requires(std::three_way_comparable_with<T, U>)
+        friend constexpr auto operator<=>(const IntrusiveList& lhs, const IntrusiveList<U, Enable_, Policies_...>& rhs) noexcept
+            -> std::compare_three_way_result_t<T, U>
+        {
+            return lhs.Compare3Way(rhs);
+        }
+
+        public:
+        U_AKR_INLINE constexpr auto begin     () const noexcept -> ConstForwardNodeIterator
+        {
+            return head;
+        }
+        U_AKR_INLINE constexpr auto end       () const noexcept -> ConstForwardNodeIterator
+        {
+            return nullptr;
+        }
+
+        U_AKR_INLINE constexpr auto rbegin    () const noexcept -> ConstReverseNodeIterator
+        {
+            return GetTail();
+        }
+        U_AKR_INLINE constexpr auto rend      () const noexcept -> ConstReverseNodeIterator
+        {
+            return nullptr;
+        }
+
+        U_AKR_INLINE constexpr auto cbegin    () const noexcept -> ConstForwardNodeIterator
+        {
+            return head;
+        }
+        U_AKR_INLINE constexpr auto cend      () const noexcept -> ConstForwardNodeIterator
+        {
+            return nullptr;
+        }
+
+        U_AKR_INLINE constexpr auto crbegin   () const noexcept -> ConstReverseNodeIterator
+        {
+            return GetTail();
+        }
+        U_AKR_INLINE constexpr auto crend     () const noexcept -> ConstReverseNodeIterator
+        {
+            return nullptr;
+        }
+
+        public:
+        U_AKR_INLINE constexpr auto begin     ()       noexcept -> ForwardNodeIterator
+        {
+            return head;
+        }
+        U_AKR_INLINE constexpr auto end       ()       noexcept -> ForwardNodeIterator
+        {
+            return nullptr;
+        }
+
+        U_AKR_INLINE constexpr auto rbegin    ()       noexcept -> ReverseNodeIterator
+        {
+            return GetTail();
+        }
+        U_AKR_INLINE constexpr auto rend      ()       noexcept -> ReverseNodeIterator
+        {
+            return nullptr;
+        }
+
+        public:
+        // Consuming range: every step pops the head and yields it already unlinked, so the body may
+        // insert it into another list right away. head->prev and the length are fixed once when the
+        // range ends; the drained list must not be touched by the body until then.
+        // The yielded node has left the list before the body sees it: a body that breaks out keeps the
+        // current node and must link it somewhere itself (e.g. back with InsertHead() after the loop).
+        struct DrainRange
+        {
+            private:
+            IntrusiveList* list    {};
+
+            T*             current {};
+            T*             tail    {};
+
+            std::size_t    taken   {};
+
+            bool           started {};
+
+            public:
+            struct Iterator
+            {
+                public:
+                using difference_type = std::ptrdiff_t;
+                using value_type      = T;
+
+                private:
+                DrainRange* range {};
+
+                public:
+                constexpr Iterator() = default;
+
+                constexpr Iterator(DrainRange* range_) noexcept:
+                    range { range_ }
+                {
+                }
+
+                public:
+                constexpr auto operator* () const noexcept -> T&
+                {
+                    return *range->current;
+                }
+
+                constexpr auto operator->() const noexcept -> T*
+                {
+                    return  range->current;
+                }
+
+                constexpr auto operator++(   ) noexcept -> Iterator&
+                {
+                    range->Pop();
+
+                    return *this;
+                }
+                constexpr void operator++(int) noexcept
+                {
+                    range->Pop();
+                }
+
+                constexpr auto operator==(std::default_sentinel_t) const noexcept -> bool
+                {
+                    return !range->current;
+                }
+            };
+
+            static_assert(std::input_iterator<Iterator>);
+
+            public:
+            constexpr explicit DrainRange(IntrusiveList& list_) noexcept:
+                list { &list_ },
+                tail { list_.GetTail() }
+            {
+            }
+
+            DrainRange(const DrainRange&) = delete;
+
+            constexpr ~DrainRange()
+            {
+                if (list->head)
+                {
+                    Links(list->head)->prev = nullptr;
+
+                    list->SetEnds(list->head, tail);
+                }
+                else
+                {
+                    list->SetEnds(nullptr, nullptr);
+                }
+
+                list->OnRangeFingerprint();
+
+                if constexpr (Enable)
+                {
+                    list->RecordLength::SubLength(taken);
+                }
+
+                if constexpr (HasStats)
+                {
+                    list->RecordStats::OnRemove(taken);
+                    list->RecordStats::OnVisit (taken);
+                }
+
+                U_AKR_PROBE(drain, list, ProbeNode(list->head), list->ProbeLength());
+            }
+
+            public:
+            // The first node is popped here, a range that is never iterated takes nothing.
+            constexpr auto begin() noexcept -> Iterator
+            {
+                if (!started)
+                {
+                    started = true;
+
+                    Pop();
+                }
+
+                return this;
+            }
+
+            constexpr auto end  () const noexcept -> std::default_sentinel_t
+            {
+                return std::default_sentinel;
+            }
+
+            private:
+            constexpr void Pop  () noexcept
+            {
+                T* node = list->head;
+
+                if (node)
+                {
+                    list->head = Links(node)->next;
+
+                    Links(node)->prev = nullptr;
+                    Links(node)->next = nullptr;
+
+                    Own(node, nullptr);
+
+                    taken++;
+                }
+
+                current = node;
+            }
+        };
+
+        constexpr auto Drain     ()       noexcept -> DrainRange
+        {
+            return DrainRange(*this);
+        }
+
+        public:
+        // Scope for many mutations of one list: the batch works on its own copy of head / last and keeps
+        // a local length delta, only node links are written while it is open. Commit() (or the
+        // destructor) publishes head, last and the length once.
+        // Until then the list object itself still shows the state from BeginBatch(), so GetHead(),
+        // GetLast(), GetLength() and iteration through the list must not be used, and the list must
+        // only be modified through the batch. Node links are already final, iterate via the batch.
+        struct Batch
+        {
+            private:
+            // edited through its probe-less primitives, Commit() fires the one batch probe
+            using Shadow = akr::IntrusiveList<T, false, Hook, CompactHead<HasCompactHead>, TrackOwner<false>>;
+
+            IntrusiveList* list {};
+
+            Shadow         shadow;
+
+            std::size_t    inserted {};
+            std::size_t    removed  {};
+
+            public:
+            constexpr explicit Batch(IntrusiveList& list_) noexcept:
+                list { &list_ }
+            {
+                shadow.SetEnds(list->head, list->GetTail());
+            }
+
+            Batch(const Batch&) = delete;
+
+            constexpr ~Batch()
+            {
+                Commit();
+
+                shadow.SetEnds(nullptr, nullptr);
+            }
+
+            public:
+            constexpr auto begin     () noexcept
+            {
+                return shadow.begin();
+            }
+            constexpr auto end       () noexcept
+            {
+                return shadow.end();
+            }
+
+            constexpr auto GetHead   () const noexcept -> ForwardNodeIterator
+            {
+                return shadow.head;
+            }
+
+            constexpr auto GetLast   () const noexcept -> ForwardNodeIterator
+            {
+                return shadow.GetTail();
+            }
+
+            constexpr auto IsEmpty   () const noexcept -> bool
+            {
+                return shadow.IsEmpty();
+            }
+
+            public:
+            constexpr auto InsertPrev(ForwardNodeIterator curNode, ForwardNodeIterator newNode) noexcept
+                -> ForwardNodeIterator
+            {
+                T* node = ToNode(newNode);
+
+                Adopt(node);
+
+                Shadow::Release(node);
+
+                shadow.LinkPrev(curNode, node);
+
+                return newNode;
+            }
+
+            constexpr auto InsertNext(ForwardNodeIterator curNode, ForwardNodeIterator newNode) noexcept
+                -> ForwardNodeIterator
+            {
+                T* node = ToNode(newNode);
+
+                Adopt(node);
+
+                Shadow::Release(node);
+
+                shadow.LinkNext(curNode, node);
+
+                return newNode;
+            }
+
+            constexpr auto InsertHead(ForwardNodeIterator newNode) noexcept -> ForwardNodeIterator
+            {
+                T* node = ToNode(newNode);
+
+                Adopt(node);
+
+                Shadow::Release(node);
+
+                shadow.LinkPrev(shadow.head, node);
+
+                return newNode;
+            }
+
+            constexpr auto InsertLast(ForwardNodeIterator newNode) noexcept -> ForwardNodeIterator
+            {
+                T* node = ToNode(newNode);
+
+                Adopt(node);
+
+                Shadow::Release(node);
+
+                shadow.LinkNext(shadow.GetTail(), node);
+
+                return newNode;
+            }
+
+            constexpr void Remove    (ForwardNodeIterator curNode) noexcept
+            {
+                T* node = ToNode(curNode);
+
+                removed++;
+
+                Own(node, nullptr);
+
+                shadow.Cut(node);
+
+                Links(node)->prev = nullptr;
+                Links(node)->next = nullptr;
+            }
+
+            constexpr void RemoveHead() noexcept
+            {
+                Remove(shadow.head);
+            }
+
+            constexpr void RemoveLast() noexcept
+            {
+                Remove(shadow.GetTail());
+            }
+
+            private:
+            // With TrackOwner a node still in a list is taken out of it first: through this batch if it
+            // is ours, else through its owner, which keeps that list's ends and length right.
+            constexpr void Adopt     (T* node) noexcept
+            {
+                if constexpr (HasOwner)
+                {
+                    if (auto owner = OwnerOf(node); owner == list)
+                    {
+                        Remove(node);
+                    }
+                    else if (owner)
+                    {
+                        owner->Remove(node);
+                    }
+                }
+
+                inserted++;
+
+                Own(node, list);
+            }
+
+            public:
+            // Publishes the batch, it may keep being used and is published again on the next Commit().
+            constexpr void Commit    () noexcept
+            {
+                list->SetEnds(shadow.head, shadow.GetTail());
+
+                list->OnRangeFingerprint();
+
+                if constexpr (Enable)
+                {
+                    list->RecordLength::AddLength(inserted);
+                    list->RecordLength::SubLength(removed );
+                }
+
+                if constexpr (HasStats)
+                {
+                    list->RecordStats::OnInsert(inserted, list->KnownLength());
+                    list->RecordStats::OnRemove(removed );
+                }
+
+                U_AKR_PROBE(batch, list, ProbeNode(list->head), list->ProbeLength());
+
+                inserted = 0;
+                removed  = 0;
+            }
+        };
+
+        constexpr auto BeginBatch()       noexcept -> Batch
+        {
+            return Batch(*this);
+        }
+
+        public:
+        constexpr void Swap      (IntrusiveList& other) noexcept
+        {
+            std::swap(head, other.head);
+            std::swap(last, other.last);
+
+            if constexpr (Enable)
+            {
+                RecordLength::SwapLength(other);
+            }
+
+            if constexpr (HasFingerprint)
+            {
+                Fingerprint::SwapFingerprint(other);
+            }
+
+            OwnAll();
+            other.OwnAll();
+        }
+
+        friend constexpr void swap(IntrusiveList& lhs, IntrusiveList& rhs) noexcept
+        {
+            lhs.Swap(rhs);
+        }
+
+        // O(1) handoff of the whole chain, *this is left empty.
+        constexpr auto TakeAll   ()       noexcept -> IntrusiveList
+        {
+            return IntrusiveList(static_cast<IntrusiveList&&>(*this));
+        }
+
+        public:
+        constexpr auto GetHead   () const noexcept -> ForwardNodeIterator
+        {
+            return head;
+        }
+
+        constexpr auto GetLast   () const noexcept -> ForwardNodeIterator
+        {
+            return GetTail();
+        }
+
+        constexpr auto IsEmpty   () const noexcept -> bool
+        {
+            return !head;
+        }
+
+        // With LazyLength the first call after an uncounted splice walks the list once.
+        constexpr auto GetLength () const noexcept -> std::size_t
+        requires(Enable)
+        {
+            if constexpr (HasLazyLength)
+            {
+                if (RecordLength::IsLengthDirty())
+                {
+                    std::size_t count {};
+
+                    for (T* iter = head; iter; iter = Links(iter)->next)
+                    {
+                        count++;
+                    }
+
+                    if constexpr (HasStats)
+                    {
+                        RecordStats::OnVisit(count);
+                    }
+
+                    RecordLength::SetCachedLength(count);
+                }
+
+                return RecordLength::GetCachedLength();
+            }
+            else
+            {
+                return RecordLength::GetLength();
+            }
+        }
+
+        // Recomputed in one walk after a range operation or RefreshFingerprint(), O(1) otherwise.
+        constexpr auto GetFingerprint() const noexcept -> std::uint64_t
+        requires(HasFingerprint)
+        {
+            if (Fingerprint::IsFingerprintDirty())
+            {
+                Fingerprint::Recompute(static_cast<const T*>(head), [](const T* node)
+                {
+                    return static_cast<const T*>(Links(const_cast<T*>(node))->next);
+                });
+            }
+
+            return Fingerprint::GetCachedFingerprint();
+        }
+
+        public:
+        // Resets the links of every node, so they can be inserted anywhere again.
+        constexpr void Clear     () noexcept
+        {
+            ClearAndDispose([](T*) noexcept
+            {
+            });
+        }
+
+        // One walk that unlinks each node and then hands it to disposer, which may destroy it.
+        // The next node is prefetched while the disposer runs on the current one.
+        template<class Disposer>
+        constexpr void ClearAndDispose(Disposer disposer) noexcept
+        {
+            U_AKR_PROBE(clear, this, ProbeNode(head), ProbeLength());
+
+            [[maybe_unused]] std::size_t visited {};
+
+            for (T* iter = head, * next; iter; iter = next)
+            {
+                next = Links(iter)->next;
+
+                detail::Prefetch(next);
+
+                Links(iter)->prev = nullptr;
+                Links(iter)->next = nullptr;
+
+                Own(iter, nullptr);
+
+                disposer(iter);
+
+                visited++;
+            }
+
+            SetEnds(nullptr, nullptr);
+
+            OnRangeFingerprint();
+
+            if constexpr (Enable)
+            {
+                RecordLength::SetToZero();
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnRemove(visited);
+                RecordStats::OnVisit (visited);
+            }
+        }
+
+        // O(1): forgets the chain without touching the links, the nodes keep pointing at each other. Relink them
+        // only with InsertXUnlinked() / AdoptChain(), which overwrite the links, or construct them anew first:
+        // InsertX() detaches the node through its stale prev / next and would write into whatever list its old
+        // neighbours sit in by then. With TrackOwner the owners are still reset, otherwise the nodes would route
+        // later operations to this list, so it walks once.
+        constexpr void ClearUnsafe() noexcept
+        {
+            U_AKR_PROBE(clear, this, ProbeNode(head), ProbeLength());
+
+            if constexpr (HasOwner)
+            {
+                for (T* iter = head; iter; iter = Links(iter)->next)
+                {
+                    Own(iter, nullptr);
+                }
+            }
+
+            if constexpr (HasStats)
+            {
+                if (auto length = KnownLength(); length != Uncounted)
+                {
+                    RecordStats::OnRemove(length);
+                }
+            }
+
+            Forget();
+        }
+
+        private:
+        // Drops the chain, the nodes still point here; for moves, where the new list owns them next.
+        constexpr void Forget    () noexcept
+        {
+            SetEnds(nullptr, nullptr);
+
+            OnRangeFingerprint();
+
+            if constexpr (Enable)
+            {
+                RecordLength::SetToZero();
+            }
+        }
+
+        public:
+        // Zeroes the RecordStats counters, highWater restarts from the current length.
+        void ResetStats() noexcept
+        requires(HasStats)
+        {
+            RecordStats::ResetStats(KnownLength());
+        }
+
+        public:
+        constexpr auto InsertPrev(ForwardNodeIterator curNode, ForwardNodeIterator newNode) noexcept
+            -> ForwardNodeIterator
+        {
+            [[maybe_unused]] std::uint64_t sample {};
+
+            if constexpr (HasLatency)
+            {
+                sample = RecordLatency::BeginSample();
+            }
+
+            Release(ToNode(newNode));
+
+            InsertPrevUnlinked(curNode, newNode);
+
+            if constexpr (HasLatency)
+            {
+                RecordLatency::EndInsert(sample);
+            }
+
+            return newNode;
+        }
+
+        constexpr auto InsertNext(ForwardNodeIterator curNode, ForwardNodeIterator newNode) noexcept
+            -> ForwardNodeIterator
+        {
+            [[maybe_unused]] std::uint64_t sample {};
+
+            if constexpr (HasLatency)
+            {
+                sample = RecordLatency::BeginSample();
+            }
+
+            Release(ToNode(newNode));
+
+            InsertNextUnlinked(curNode, newNode);
+
+            if constexpr (HasLatency)
+            {
+                RecordLatency::EndInsert(sample);
+            }
+
+            return newNode;
+        }
+
+        constexpr auto InsertHead(ForwardNodeIterator newNode) noexcept -> ForwardNodeIterator
+        {
+            return InsertPrev(head, newNode);
+        }
+
+        constexpr auto InsertLast(ForwardNodeIterator newNode) noexcept -> ForwardNodeIterator
+        {
+            return InsertNext(GetTail(), newNode);
+        }
+
+        public:
+        // newNode must not be linked into any list, its stale prev / next are overwritten without Detach().
+        constexpr auto InsertPrevUnlinked(ForwardNodeIterator curNode, ForwardNodeIterator newNode) noexcept
+            -> ForwardNodeIterator
+        {
+            LinkPrev(curNode, ToNode(newNode));
+
+            U_AKR_PROBE(insert_prev, this, ProbeNode(newNode), ProbeLength());
+
+            return newNode;
+        }
+
+        constexpr auto InsertNextUnlinked(ForwardNodeIterator curNode, ForwardNodeIterator newNode) noexcept
+            -> ForwardNodeIterator
+        {
+            LinkNext(curNode, ToNode(newNode));
+
+            U_AKR_PROBE(insert_next, this, ProbeNode(newNode), ProbeLength());
+
+            return newNode;
+        }
+
+        constexpr auto InsertHeadUnlinked(ForwardNodeIterator newNode) noexcept -> ForwardNodeIterator
+        {
+            return InsertPrevUnlinked(head, newNode);
+        }
+
+        constexpr auto InsertLastUnlinked(ForwardNodeIterator newNode) noexcept -> ForwardNodeIterator
+        {
+            return InsertNextUnlinked(GetTail(), newNode);
+        }
+
+        public:
+        // Bulk load: the nodes are chained in one tight loop and attached with a single head / last update.
+        // The nodes must not be linked into any list. Iter may yield T* or T&.
+        template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+        constexpr auto InsertRangePrev(ForwardNodeIterator curNode, Iter first, Sent limit) noexcept
+            -> ForwardNodeIterator
+        {
+            if (first == limit)
+            {
+                return curNode;
+            }
+
+            T* chainHead = ToNode(*first);
+            T* chainLast = chainHead;
+
+            std::size_t count { 1 };
+
+            for (++first; first != limit; ++first)
+            {
+                T* node = ToNode(*first);
+
+                Links(chainLast)->next = node;
+                Links(node     )->prev = chainLast;
+
+                chainLast = node;
+
+                count++;
+            }
+
+            LinkChain(curNode ? PrevOf(ToNode(curNode)) : GetTail(), ToNode(curNode), chainHead, chainLast, count);
+
+            U_AKR_PROBE(insert_range, this, ProbeNode(chainHead), ProbeLength());
+
+            return chainHead;
+        }
+
+        template<std::input_iterator Iter, std::sentinel_for<Iter> Sent>
+        constexpr auto InsertRangeLast(Iter first, Sent limit) noexcept -> ForwardNodeIterator
+        {
+            return InsertRangePrev(nullptr, first, limit);
+        }
+
+        // Appends a chain the caller already linked through next / prev, from headNode to lastNode.
+        // count must be the number of nodes in it; only the chain's outer links are written.
+        constexpr void AdoptChain(ForwardNodeIterator headNode, ForwardNodeIterator lastNode, std::size_t count) noexcept
+        {
+            LinkChain(GetTail(), nullptr, ToNode(headNode), ToNode(lastNode), count);
+
+            U_AKR_PROBE(insert_range, this, ProbeNode(headNode), ProbeLength());
+        }
+
+        private:
+        constexpr void LinkChain (T* before, T* after, T* chainHead, T* chainLast, std::size_t count) noexcept
+        {
+            T* newHead = before ? head      : chainHead;
+            T* newLast = after  ? GetTail() : chainLast;
+
+            Links(chainHead)->prev = before;
+            Links(chainLast)->next = after;
+
+            if (before)
+            {
+                Links(before)->next = chainHead;
+            }
+
+            if (after)
+            {
+                Links(after)->prev = chainLast;
+            }
+
+            SetEnds(newHead, newLast);
+
+            OnRangeFingerprint();
+
+            if constexpr (HasOwner)
+            {
+                for (T* iter = chainHead; iter != after; iter = Links(iter)->next)
+                {
+                    Own(iter, this);
+                }
+            }
+
+            if constexpr (HasLazyLength)
+            {
+                if (count == Uncounted)
+                {
+                    RecordLength::MarkLengthDirty();
+                }
+                else
+                {
+                    RecordLength::AddLength(count);
+                }
+            }
+            else if constexpr (Enable)
+            {
+                RecordLength::AddLength(count);
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnInsert(count, KnownLength());
+            }
+        }
+
+        // Cuts chainHead..chainLast out with one relink of its neighbours, the chain keeps its inner links.
+        constexpr void UnlinkChain(T* chainHead, T* chainLast, std::size_t count) noexcept
+        {
+            T* before = PrevOf(chainHead);
+            T* after  = Links(chainLast)->next;
+            T* tail   = GetTail();
+
+            if (before)
+            {
+                Links(before)->next = after;
+            }
+
+            if (after)
+            {
+                Links(after)->prev = before;
+            }
+
+            SetEnds(before ? head : after, after ? tail : before);
+
+            OnRangeFingerprint();
+
+            if constexpr (HasLazyLength)
+            {
+                // count 0 is a splice within this list, which is only empty until LinkChain() puts the chain back
+                if (!head && count != 0)
+                {
+                    RecordLength::SetToZero();
+                }
+                else if (count == Uncounted)
+                {
+                    RecordLength::MarkLengthDirty();
+                }
+                else
+                {
+                    RecordLength::SubLength(count);
+                }
+            }
+            else if constexpr (Enable)
+            {
+                RecordLength::SubLength(count);
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnRemove(count);
+            }
+        }
+
+        // A range count nobody has walked, only LazyLength can take one.
+        static constexpr std::size_t Uncounted = static_cast<std::size_t>(-1);
+
+        template<class Ref>
+        static constexpr auto ToNode(Ref&& ref) noexcept -> T*
+        {
+            if constexpr (std::convertible_to<Ref, T*>)
+            {
+                return static_cast<T*>(ref);
+            }
+            else if constexpr (std::same_as<std::remove_cvref_t<Ref>, ForwardNodeIterator>)
+            {
+                return ref.operator->();
+            }
+            else
+            {
+                return __builtin_addressof(ref);
+            }
+        }
+
+        private:
+        // The source side of a node transfer, timed and counted as a remove on other; the caller links
+        // node in and fires the probe.
+        template<class U, bool Enable_, class... Policies_>
+        constexpr void Take      (IntrusiveList<U, Enable_, Policies_...>& other, T* node) noexcept
+        {
+            using Other = IntrusiveList<U, Enable_, Policies_...>;
+
+            [[maybe_unused]] std::uint64_t sample {};
+
+            if constexpr (Other::HasLatency)
+            {
+                sample = other.Other::RecordLatency::BeginSample();
+            }
+
+            other.Cut(node);
+
+            if constexpr (Other::HasLatency)
+            {
+                other.Other::RecordLatency::EndRemove(sample);
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnSplice();
+            }
+        }
+
+        public:
+        // Moves newNode out of other in a single unlink + relink, newNode must belong to other.
+        // Fires one splice probe, not a remove and an insert.
+        template<class U, bool Enable_, class... Policies_>
+        constexpr auto TransferPrev(ForwardNodeIterator curNode, ForwardNodeIterator newNode,
+                                    IntrusiveList<U, Enable_, Policies_...>& other) noexcept -> ForwardNodeIterator
+        {
+            Take(other, ToNode(newNode));
+
+            LinkPrev(curNode, ToNode(newNode));
+
+            U_AKR_PROBE(splice, this, ProbeNode(newNode), ProbeLength());
+
+            return newNode;
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        constexpr auto TransferNext(ForwardNodeIterator curNode, ForwardNodeIterator newNode,
+                                    IntrusiveList<U, Enable_, Policies_...>& other) noexcept -> ForwardNodeIterator
+        {
+            Take(other, ToNode(newNode));
+
+            LinkNext(curNode, ToNode(newNode));
+
+            U_AKR_PROBE(splice, this, ProbeNode(newNode), ProbeLength());
+
+            return newNode;
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        constexpr auto TransferHead(ForwardNodeIterator newNode,
+                                    IntrusiveList<U, Enable_, Policies_...>& other) noexcept -> ForwardNodeIterator
+        {
+            Take(other, ToNode(newNode));
+
+            LinkPrev(head, ToNode(newNode));
+
+            U_AKR_PROBE(splice, this, ProbeNode(newNode), ProbeLength());
+
+            return newNode;
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        constexpr auto TransferLast(ForwardNodeIterator newNode,
+                                    IntrusiveList<U, Enable_, Policies_...>& other) noexcept -> ForwardNodeIterator
+        {
+            Take(other, ToNode(newNode));
+
+            LinkNext(GetTail(), ToNode(newNode));
+
+            U_AKR_PROBE(splice, this, ProbeNode(newNode), ProbeLength());
+
+            return newNode;
+        }
+
+        public:
+        template<class U, bool Enable_, class... Policies_>
+        constexpr auto InsertPrev(ForwardNodeIterator curNode, ForwardNodeIterator newNode,
+                                  IntrusiveList<U, Enable_, Policies_...>& other) noexcept -> ForwardNodeIterator
+        {
+            return TransferPrev(curNode, newNode, other);
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        constexpr auto InsertNext(ForwardNodeIterator curNode, ForwardNodeIterator newNode,
+                                  IntrusiveList<U, Enable_, Policies_...>& other) noexcept -> ForwardNodeIterator
+        {
+            return TransferNext(curNode, newNode, other);
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        constexpr auto InsertHead(ForwardNodeIterator newNode,
+                                  IntrusiveList<U, Enable_, Policies_...>& other) noexcept -> ForwardNodeIterator
+        {
+            return TransferHead(newNode, other);
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        constexpr auto InsertLast(ForwardNodeIterator newNode,
+                                  IntrusiveList<U, Enable_, Policies_...>& other) noexcept -> ForwardNodeIterator
+        {
+            return TransferLast(newNode, other);
+        }
+
+        public:
+        // Moves [first, limit) of other before curNode (nullptr appends) with one relink at each end;
+        // curNode must not lie inside the range. The range is walked once to count it, unless the count
+        // is passed in or both lists use LazyLength (without RecordStats), which only marks them dirty.
+        template<bool Enable_, class... Policies_>
+        constexpr void Splice    (ForwardNodeIterator curNode, IntrusiveList<T, Enable_, Policies_...>& other,
+                                  typename IntrusiveList<T, Enable_, Policies_...>::ForwardNodeIterator first,
+                                  typename IntrusiveList<T, Enable_, Policies_...>::ForwardNodeIterator limit) noexcept
+        {
+            SpliceRange(curNode, other, first.operator->(), limit.operator->(), Uncounted);
+        }
+
+        template<bool Enable_, class... Policies_>
+        constexpr void Splice    (ForwardNodeIterator curNode, IntrusiveList<T, Enable_, Policies_...>& other,
+                                  typename IntrusiveList<T, Enable_, Policies_...>::ForwardNodeIterator first,
+                                  typename IntrusiveList<T, Enable_, Policies_...>::ForwardNodeIterator limit,
+                                  std::size_t count) noexcept
+        {
+            SpliceRange(curNode, other, first.operator->(), limit.operator->(), count);
+        }
+
+        // Moves all of other before curNode, its length goes along in O(1) unless it is dirty.
+        template<bool Enable_, class... Policies_>
+        constexpr void Splice    (ForwardNodeIterator curNode, IntrusiveList<T, Enable_, Policies_...>& other) noexcept
+        {
+            using Other = IntrusiveList<T, Enable_, Policies_...>;
+
+            std::size_t count = Uncounted;
+
+            if constexpr (Other::HasLazyLength)
+            {
+                if (!other.Other::RecordLength::IsLengthDirty())
+                {
+                    count = other.Other::RecordLength::GetCachedLength();
+                }
+            }
+            else if constexpr (Other::HasLength)
+            {
+                count = other.GetLength();
+            }
+
+            SpliceRange(curNode, other, other.head, nullptr, count);
+        }
+
+        // Cuts the list before curNode and returns curNode..tail as a new list. O(1) with the suffix count
+        // or LazyLength (both lengths go dirty), else the count walks from curNode in both directions and
+        // stops at whichever end comes first.
+        constexpr auto SplitAt   (ForwardNodeIterator curNode) noexcept -> IntrusiveList
+        {
+            std::size_t count = Uncounted;
+
+            if constexpr (HasLength && !HasLazyLength)
+            {
+                if (curNode)
+                {
+                    count = SuffixLength(ToNode(curNode));
+                }
+            }
+
+            return SplitAt(curNode, count);
+        }
+
+        constexpr auto SplitAt   (ForwardNodeIterator curNode, std::size_t count) noexcept -> IntrusiveList
+        {
+            IntrusiveList suffix;
+
+            suffix.SpliceRange(nullptr, *this, ToNode(curNode), nullptr, count);
+
+            return suffix;
+        }
+
+        // As SplitAt(), the new list starts after curNode.
+        constexpr auto SplitAfter(ForwardNodeIterator curNode) noexcept -> IntrusiveList
+        {
+            return SplitAt(Links(ToNode(curNode))->next);
+        }
+
+        constexpr auto SplitAfter(ForwardNodeIterator curNode, std::size_t count) noexcept -> IntrusiveList
+        {
+            return SplitAt(Links(ToNode(curNode))->next, count);
+        }
+
+        // Cuts the whole list into lists of k nodes, the last one possibly shorter, and hands them in order
+        // to func(IntrusiveList&&) in one walk with exact lengths. Returns the number of chunks.
+        template<class Func>
+        constexpr auto SplitEvery(std::size_t k, Func func) noexcept -> std::size_t
+        {
+            std::size_t chunks {};
+
+            if (!k)
+            {
+                return chunks;
+            }
+
+            while (head)
+            {
+                T* limit = head;
+
+                std::size_t count {};
+
+                for (; limit && count < k; limit = Links(limit)->next)
+                {
+                    count++;
+                }
+
+                IntrusiveList chunk;
+
+                chunk.SpliceRange(nullptr, *this, head, limit, count);
+
+                func(static_cast<IntrusiveList&&>(chunk));
+
+                chunks++;
+            }
+
+            return chunks;
+        }
+
+        private:
+        template<bool Enable_, class... Policies_>
+        constexpr void SpliceRange(ForwardNodeIterator curNode, IntrusiveList<T, Enable_, Policies_...>& other,
+                                   T* chainHead, T* limit, std::size_t count) noexcept
+        {
+            using Other = IntrusiveList<T, Enable_, Policies_...>;
+
+            static_assert(std::same_as<typename Other::Hook, Hook>, "both lists must link through the same hook");
+
+            if (chainHead == limit)
+            {
+                return;
+            }
+
+            T* chainLast = limit ? Links(limit)->prev : other.GetTail();
+
+            constexpr bool NeedsCount = HasStats        || (HasLength        && !HasLazyLength       ) ||
+                                        Other::HasStats || (Other::HasLength && !Other::HasLazyLength);
+
+            if (static_cast<const void*>(this) == &other)
+            {
+                // the length does not change
+                count = 0;
+            }
+            else if constexpr (NeedsCount)
+            {
+                if (count == Uncounted)
+                {
+                    count = 1;
+
+                    for (T* iter = chainHead; iter != chainLast; iter = Links(iter)->next)
+                    {
+                        count++;
+                    }
+
+                    if constexpr (HasStats)
+                    {
+                        RecordStats::OnVisit(count);
+                    }
+                }
+            }
+
+            other.UnlinkChain(chainHead, chainLast, count);
+
+            LinkChain(curNode ? PrevOf(ToNode(curNode)) : GetTail(), ToNode(curNode), chainHead, chainLast, count);
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnSplice();
+            }
+
+            U_AKR_PROBE(splice, this, ProbeNode(chainHead), ProbeLength());
+        }
+
+        public:
+        // With TrackOwner a node of another list is removed from that list, an unlinked node is ignored.
+        constexpr void Remove    (ForwardNodeIterator curNode) noexcept
+        {
+            if constexpr (HasOwner)
+            {
+                if (auto owner = OwnerOf(curNode); owner != this)
+                {
+                    if (owner)
+                    {
+                        owner->Remove(curNode);
+                    }
+
+                    return;
+                }
+            }
+
+            [[maybe_unused]] std::uint64_t sample {};
+
+            if constexpr (HasLatency)
+            {
+                sample = RecordLatency::BeginSample();
+            }
+
+            T* node = ToNode(curNode);
+
+            Unlink(node);
+
+            Links(node)->prev = nullptr;
+            Links(node)->next = nullptr;
+
+            if constexpr (HasLatency)
+            {
+                RecordLatency::EndRemove(sample);
+            }
+        }
+
+        constexpr void RemoveHead() noexcept
+        {
+            Remove(head);
+        }
+
+        constexpr void RemoveLast() noexcept
+        {
+            Remove(GetTail());
+        }
+
+        public:
+        constexpr auto Contains  (ForwardNodeIterator curNode) const noexcept -> bool
+        requires(HasOwner)
+        {
+            return OwnerOf(curNode) == this;
+        }
+
+        static constexpr auto OwnerOf(ForwardNodeIterator curNode) noexcept -> IntrusiveList*
+        requires(HasOwner)
+        {
+            return static_cast<IntrusiveList*>(OwnerSlot(ToNode(curNode)));
+        }
+
+        public:
+        // Returns the node after curNode, so removal while iterating is just iter = list.Erase(iter).
+        constexpr auto Erase     (ForwardNodeIterator curNode) noexcept -> ForwardNodeIterator
+        {
+            ForwardNodeIterator next = Links(ToNode(curNode))->next;
+
+            Remove(curNode);
+
+            return next;
+        }
+
+        // Removes [first, limit) with one relink of its neighbours and one length update.
+        constexpr auto EraseRange(ForwardNodeIterator first, ForwardNodeIterator limit) noexcept -> ForwardNodeIterator
+        {
+            if (first == limit)
+            {
+                return limit;
+            }
+
+            T* after  = ToNode(limit);
+            T* before = PrevOf(ToNode(first));
+            T* tail   = GetTail();
+
+            std::size_t count {};
+
+            for (T* iter = ToNode(first), * next; iter != after; iter = next)
+            {
+                next = Links(iter)->next;
+
+                Links(iter)->prev = nullptr;
+                Links(iter)->next = nullptr;
+
+                Own(iter, nullptr);
+
+                count++;
+            }
+
+            if (before)
+            {
+                Links(before)->next = after;
+            }
+
+            if (after)
+            {
+                Links(after)->prev = before;
+            }
+
+            SetEnds(before ? head : after, after ? tail : before);
+
+            OnRangeFingerprint();
+
+            if constexpr (Enable)
+            {
+                RecordLength::SubLength(count);
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnRemove(count);
+                RecordStats::OnVisit (count);
+            }
+
+            U_AKR_PROBE(erase, this, ProbeNode(first), ProbeLength());
+
+            return limit;
+        }
+
+        // One pass over the list; kept neighbours are only relinked where a run of removed nodes ends.
+        // disposer receives T* after the node is unlinked and may destroy it. Returns the removed count.
+        template<class Pred, class Disposer>
+        constexpr auto RemoveIfAndDispose(Pred pred, Disposer disposer) noexcept -> std::size_t
+        {
+            T* keep {};
+
+            std::size_t removed {};
+            std::size_t visited {};
+
+            bool gap {};
+
+            for (T* iter = head, * next; iter; iter = next)
+            {
+                next = Links(iter)->next;
+
+                visited++;
+
+                if (pred(*iter))
+                {
+                    Links(iter)->prev = nullptr;
+                    Links(iter)->next = nullptr;
+
+                    Own(iter, nullptr);
+
+                    disposer(iter);
+
+                    removed++;
+
+                    gap = true;
+                }
+                else
+                {
+                    if (gap)
+                    {
+                        Links(iter)->prev = keep;
+
+                        if (keep)
+                        {
+                            Links(keep)->next = iter;
+                        }
+                        else
+                        {
+                            head = iter;
+                        }
+
+                        gap = false;
+                    }
+
+                    keep = iter;
+                }
+            }
+
+            if (gap)
+            {
+                if (keep)
+                {
+                    Links(keep)->next = nullptr;
+                }
+                else
+                {
+                    head = nullptr;
+                }
+            }
+
+            SetEnds(head, keep);
+
+            OnRangeFingerprint();
+
+            if constexpr (Enable)
+            {
+                RecordLength::SubLength(removed);
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnRemove(removed);
+                RecordStats::OnVisit (visited);
+            }
+
+            U_AKR_PROBE(erase, this, ProbeNode(head), ProbeLength());
+
+            return removed;
+        }
+
+        template<class Pred>
+        constexpr auto RemoveIf  (Pred pred) noexcept -> std::size_t
+        {
+            return RemoveIfAndDispose(pred, [](T*) noexcept
+            {
+            });
+        }
+
+        public:
+        // Keeps the first node of every run of consecutive nodes equal by eq(const T&, const T&), the others
+        // are unlinked and passed to disposer. Returns the number removed.
+        template<class Eq, class Disposer>
+        constexpr auto Unique    (Eq eq, Disposer disposer) noexcept -> std::size_t
+        {
+            const T* kept {};
+
+            return RemoveIfAndDispose([&](const T& value)
+            {
+                if (kept && eq(*kept, value))
+                {
+                    return true;
+                }
+
+                kept = &value;
+
+                return false;
+            }, disposer);
+        }
+
+        template<class Eq>
+        constexpr auto Unique    (Eq eq) noexcept -> std::size_t
+        {
+            return Unique(eq, [](T*) noexcept
+            {
+            });
+        }
+
+        // Set operations on lists sorted by comp(const T&, const T&), with the multiset counts of std::set_*.
+        // Each is one merge walk over both lists and relinks instead of copying.
+
+        // Moves the nodes of other that are missing here into place, runs of them at once; the ones this
+        // list already has stay in other. Returns the number moved.
+        template<bool Enable_, class... Policies_, class Comp>
+        constexpr auto MergeUnion(IntrusiveList<T, Enable_, Policies_...>& other, Comp comp) noexcept -> std::size_t
+        {
+            using Other = IntrusiveList<T, Enable_, Policies_...>;
+
+            static_assert(std::same_as<typename Other::Hook, Hook>, "both lists must link through the same hook");
+
+            if (static_cast<const void*>(this) == &other)
+            {
+                return 0;
+            }
+
+            std::size_t moved {};
+
+            T* a = head;
+            T* b = other.head;
+
+            while (a && b)
+            {
+                if (comp(static_cast<const T&>(*a), static_cast<const T&>(*b)))
+                {
+                    a = Links(a)->next;
+                }
+                else if (comp(static_cast<const T&>(*b), static_cast<const T&>(*a)))
+                {
+                    T* runHead = b;
+                    T* runLast = b;
+
+                    std::size_t count = 1;
+
+                    for (b = Links(b)->next; b && comp(static_cast<const T&>(*b), static_cast<const T&>(*a)); b = Links(b)->next)
+                    {
+                        runLast = b;
+
+                        count++;
+                    }
+
+                    other.UnlinkChain(runHead, runLast, count);
+
+                    LinkChain(PrevOf(a), a, runHead, runLast, count);
+
+                    moved += count;
+                }
+                else
+                {
+                    a = Links(a)->next;
+                    b = Links(b)->next;
+                }
+            }
+
+            // the rest sorts after everything here
+            if (b)
+            {
+                T* last = other.GetTail();
+
+                std::size_t count {};
+
+                for (T* iter = b; iter; iter = Links(iter)->next)
+                {
+                    count++;
+                }
+
+                other.UnlinkChain(b, last, count);
+
+                LinkChain(GetTail(), nullptr, b, last, count);
+
+                moved += count;
+            }
+
+            U_AKR_PROBE(merge, this, &other, ProbeLength());
+
+            return moved;
+        }
+
+        // Unlinks the nodes that other does not have and passes them to disposer. Returns the number removed.
+        template<bool Enable_, class... Policies_, class Comp, class Disposer>
+        constexpr auto Intersect (const IntrusiveList<T, Enable_, Policies_...>& other, Comp comp, Disposer disposer) noexcept
+            -> std::size_t
+        {
+            return RemoveIfAndDispose(MatchSorted(other, comp, false), disposer);
+        }
+
+        template<bool Enable_, class... Policies_, class Comp>
+        constexpr auto Intersect (const IntrusiveList<T, Enable_, Policies_...>& other, Comp comp) noexcept -> std::size_t
+        {
+            return Intersect(other, comp, [](T*) noexcept
+            {
+            });
+        }
+
+        // Unlinks the nodes that other has as well and passes them to disposer. Returns the number removed.
+        template<bool Enable_, class... Policies_, class Comp, class Disposer>
+        constexpr auto Subtract  (const IntrusiveList<T, Enable_, Policies_...>& other, Comp comp, Disposer disposer) noexcept
+            -> std::size_t
+        {
+            return RemoveIfAndDispose(MatchSorted(other, comp, true), disposer);
+        }
+
+        template<bool Enable_, class... Policies_, class Comp>
+        constexpr auto Subtract  (const IntrusiveList<T, Enable_, Policies_...>& other, Comp comp) noexcept -> std::size_t
+        {
+            return Subtract(other, comp, [](T*) noexcept
+            {
+            });
+        }
+
+        public:
+        // The walks below keep several independent pointer chains in flight instead of one, so a cold list
+        // costs about one cache miss per step for all of them together: the list is read from both ends at
+        // once (the back walk finishes the back half), and the loads of the next nodes are issued before
+        // the current ones are compared.
+        template<class Pred>
+        constexpr auto FindIf    (Pred pred)       noexcept -> ForwardNodeIterator
+        {
+            return FindNode(pred);
+        }
+
+        template<class Pred>
+        constexpr auto FindIf    (Pred pred) const noexcept -> ConstForwardNodeIterator
+        {
+            return FindNode([&](T& value)
+            {
+                return pred(static_cast<const T&>(value));
+            });
+        }
+
+        template<class Pred>
+        constexpr auto CountIf   (Pred pred) const noexcept -> std::size_t
+        {
+            std::size_t count   {};
+            std::size_t visited {};
+
+            for (T* front = head, * back = GetTail(); front;)
+            {
+                T* frontNext = Links(front)->next;
+                T* backPrev  = Links(back )->prev;
+
+                detail::Prefetch(frontNext);
+                detail::Prefetch(backPrev );
+
+                count += pred(static_cast<const T&>(*front)) ? 1 : 0;
+                visited++;
+
+                if (front == back)
+                {
+                    break;
+                }
+
+                count += pred(static_cast<const T&>(*back )) ? 1 : 0;
+                visited++;
+
+                if (frontNext == back)
+                {
+                    break;
+                }
+
+                front = frontNext;
+                back  = backPrev;
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnVisit(visited);
+            }
+
+            return count;
+        }
+
+        // Element-wise ==; lists of equal length are compared from both ends at once.
+        template<class U, bool Enable_, class... Policies_, class Eq>
+        constexpr auto Equal     (const IntrusiveList<U, Enable_, Policies_...>& other, Eq eq) const noexcept -> bool
+        {
+            using Other = IntrusiveList<U, Enable_, Policies_...>;
+
+            if (auto l = KnownLength(), r = other.KnownLength(); l != Uncounted && r != Uncounted && l != r)
+            {
+                return false;
+            }
+
+            T* lFront = head;
+            T* lBack  = GetTail();
+            U* rFront = other.head;
+            U* rBack  = other.GetTail();
+
+            if (!lFront || !rFront)
+            {
+                return !lFront && !rFront;
+            }
+
+            // both sides meet in the middle on the same step only if the lengths are equal
+            while (true)
+            {
+                T* lNext = Links(lFront)->next;
+                T* lPrev = Links(lBack )->prev;
+                U* rNext = Other::Links(rFront)->next;
+                U* rPrev = Other::Links(rBack )->prev;
+
+                detail::Prefetch(lNext);
+                detail::Prefetch(lPrev);
+                detail::Prefetch(rNext);
+                detail::Prefetch(rPrev);
+
+                if ((lFront == lBack) != (rFront == rBack) || !eq(static_cast<const T&>(*lFront), static_cast<const U&>(*rFront)))
+                {
+                    return false;
+                }
+
+                if (lFront == lBack)
+                {
+                    return true;
+                }
+
+                if ((lNext == lBack) != (rNext == rBack) || !eq(static_cast<const T&>(*lBack ), static_cast<const U&>(*rBack )))
+                {
+                    return false;
+                }
+
+                if (lNext == lBack)
+                {
+                    return true;
+                }
+
+                lFront = lNext;
+                lBack  = lPrev;
+                rFront = rNext;
+                rBack  = rPrev;
+            }
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        requires(std::equality_comparable_with<T, U>)
+        constexpr auto Equal     (const IntrusiveList<U, Enable_, Policies_...>& other) const noexcept -> bool
+        {
+            return Equal(other, [](const T& l, const U& r)
+            {
+                return l == r;
+            });
+        }
+
+        // Lexicographical comp(T, U) -> ordering; from both ends at once when both lengths are known and equal,
+        // the back walk keeping the first difference it has seen so far.
+        template<class U, bool Enable_, class... Policies_, class Comp>
+        constexpr auto Compare3Way(const IntrusiveList<U, Enable_, Policies_...>& other, Comp comp) const noexcept
+            -> decltype(comp(std::declval<const T&>(), std::declval<const U&>()))
+        {
+            using Other = IntrusiveList<U, Enable_, Policies_...>;
+            using Order = decltype(comp(std::declval<const T&>(), std::declval<const U&>()));
+
+            T* lFront = head;
+            U* rFront = other.head;
+
+            if (auto l = KnownLength(), r = other.KnownLength(); l != Uncounted && l == r && l)
+            {
+                T* lBack = GetTail();
+                U* rBack = other.GetTail();
+
+                Order back = std::strong_ordering::equal;
+
+                while (true)
+                {
+                    T* lNext = Links(lFront)->next;
+                    T* lPrev = Links(lBack )->prev;
+                    U* rNext = Other::Links(rFront)->next;
+                    U* rPrev = Other::Links(rBack )->prev;
+
+                    detail::Prefetch(lNext);
+                    detail::Prefetch(lPrev);
+                    detail::Prefetch(rNext);
+                    detail::Prefetch(rPrev);
+
+                    if (auto order = comp(static_cast<const T&>(*lFront), static_cast<const U&>(*rFront)); order != 0)
+                    {
+                        return order;
+                    }
+
+                    if (lFront == lBack)
+                    {
+                        return back;
+                    }
+
+                    if (auto order = comp(static_cast<const T&>(*lBack ), static_cast<const U&>(*rBack )); order != 0)
+                    {
+                        back = order;
+                    }
+
+                    if (lNext == lBack)
+                    {
+                        return back;
+                    }
+
+                    lFront = lNext;
+                    lBack  = lPrev;
+                    rFront = rNext;
+                    rBack  = rPrev;
+                }
+            }
+
+            while (lFront && rFront)
+            {
+                T* lNext = Links(lFront)->next;
+                U* rNext = Other::Links(rFront)->next;
+
+                detail::Prefetch(lNext);
+                detail::Prefetch(rNext);
+
+                if (auto order = comp(static_cast<const T&>(*lFront), static_cast<const U&>(*rFront)); order != 0)
+                {
+                    return order;
+                }
+
+                lFront = lNext;
+                rFront = rNext;
+            }
+
+            return !lFront ? (!rFront ? std::strong_ordering::equal : std::strong_ordering::less) : std::strong_ordering::greater;
+        }
+
+        template<class U, bool Enable_, class... Policies_>
+        requires(std::three_way_comparable_with<T, U>)
+        constexpr auto Compare3Way(const IntrusiveList<U, Enable_, Policies_...>& other) const noexcept
+            -> std::compare_three_way_result_t<T, U>
+        {
+            return Compare3Way(other, [](const T& l, const U& r)
+            {
+                return l <=> r;
+            });
+        }
+
+        public:
+        // The reorderings below relink in place, lengths and owners stay as they are.
+        constexpr void Reverse   () noexcept
+        {
+            if (!head)
+            {
+                return;
+            }
+
+            T* first = head;
+            T* tail  = GetTail();
+
+            OpenChain();
+
+            std::size_t visited {};
+
+            for (T* iter = first, * next; iter; iter = next)
+            {
+                auto links = Links(iter);
+
+                next = links->next;
+
+                detail::Prefetch(next);
+
+                links->next = links->prev;
+                links->prev = next;
+
+                visited++;
+            }
+
+            SetEnds(tail, first);
+
+            OnRangeFingerprint();
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnVisit(visited);
+            }
+        }
+
+        // O(1): newHead becomes the head, the nodes before it move behind the old tail; end() is a no-op.
+        constexpr void Rotate    (ForwardNodeIterator newHead) noexcept
+        {
+            T* newFirst = ToNode(newHead);
+
+            if (!newFirst || newFirst == head)
+            {
+                return;
+            }
+
+            T* first   = head;
+            T* tail    = GetTail();
+            T* newTail = PrevOf(newFirst);
+
+            if constexpr (HasFingerprint)
+            {
+                Fingerprint::OnRotateFingerprint(Fingerprint::HashAfter(first), Fingerprint::HashAfter(tail),
+                                                 Fingerprint::HashAfter(newFirst), Fingerprint::HashAfter(newTail));
+            }
+
+            Links(tail)->next = first;
+            Links(first)->prev = tail;
+
+            Links(newTail)->next = nullptr;
+            Links(newFirst)->prev = nullptr;
+
+            SetEnds(newFirst, newTail);
+        }
+
+        // Moves the nodes matching pred in front of the others and returns the first node that does not
+        // match (or end()). Walks in from both ends and only relinks misplaced pairs, so the order within
+        // a group is lost.
+        template<class Pred>
+        constexpr auto Partition (Pred pred) noexcept -> ForwardNodeIterator
+        {
+            if (!head)
+            {
+                return nullptr;
+            }
+
+            T* first = head;
+            T* tail  = GetTail();
+
+            OpenChain();
+
+            std::size_t visited {};
+
+            auto finish = [&](T* bound) noexcept -> ForwardNodeIterator
+            {
+                SetEnds(first, tail);
+
+                OnRangeFingerprint();
+
+                if constexpr (HasStats)
+                {
+                    RecordStats::OnVisit(visited);
+                }
+
+                return bound;
+            };
+
+            // [front, back] is still unvisited
+            for (T* front = first, * back = tail;;)
+            {
+                for (; pred(*front); front = Links(front)->next)
+                {
+                    visited++;
+
+                    if (front == back)
+                    {
+                        return finish(Links(front)->next);
+                    }
+                }
+
+                visited++;
+
+                if (front == back)
+                {
+                    return finish(front);
+                }
+
+                for (; !pred(*back); back = Links(back)->prev)
+                {
+                    visited++;
+
+                    if (Links(back)->prev == front)
+                    {
+                        return finish(front);
+                    }
+                }
+
+                visited++;
+
+                // front does not match, back does and comes later
+                T* frontNext = Links(front)->next;
+                T* backPrev  = Links(back )->prev;
+
+                SwapNodes(front, back);
+
+                first = first == front ? back  : first;
+                tail  = tail  == back  ? front : tail;
+
+                if (frontNext == back)
+                {
+                    return finish(front);
+                }
+
+                front = frontNext;
+                back  = backPrev;
+            }
+        }
+
+        // As Partition(), keeping the relative order within both groups. Only the matching nodes that are
+        // not already in the front group are relinked.
+        template<class Pred>
+        constexpr auto StablePartition(Pred pred) noexcept -> ForwardNodeIterator
+        {
+            if (!head)
+            {
+                return nullptr;
+            }
+
+            T* first = head;
+            T* tail  = GetTail();
+
+            OpenChain();
+
+            std::size_t visited {};
+
+            // last node of the front group, nullptr while it is empty
+            T* split {};
+
+            for (T* iter = first, * next; iter; iter = next)
+            {
+                next = Links(iter)->next;
+
+                detail::Prefetch(next);
+
+                visited++;
+
+                if (!pred(*iter))
+                {
+                    continue;
+                }
+
+                if (Links(iter)->prev != split)
+                {
+                    T* prev = Links(iter)->prev;
+
+                    Links(prev)->next = next;
+
+                    if (next)
+                    {
+                        Links(next)->prev = prev;
+                    }
+                    else
+                    {
+                        tail = prev;
+                    }
+
+                    LinkBetween(split, iter, split ? Links(split)->next : first);
+
+                    first = split ? first : iter;
+                }
+
+                split = iter;
+            }
+
+            SetEnds(first, tail);
+
+            OnRangeFingerprint();
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnVisit(visited);
+            }
+
+            return split ? Links(split)->next : first;
+        }
+
+        private:
+        // A predicate for RemoveIfAndDispose() over this sorted list: true for a node that has (matched)
+        // or lacks (!matched) an equal node in the sorted other, each node of other pairs with one node here.
+        template<bool Enable_, class... Policies_, class Comp>
+        static constexpr auto MatchSorted(const IntrusiveList<T, Enable_, Policies_...>& other, Comp comp, bool matched) noexcept
+        {
+            using Other = IntrusiveList<T, Enable_, Policies_...>;
+
+            return [cursor = other.head, comp, matched](const T& value) mutable
+            {
+                while (cursor && comp(static_cast<const T&>(*cursor), value))
+                {
+                    cursor = Other::Links(cursor)->next;
+                }
+
+                if (cursor && !comp(value, static_cast<const T&>(*cursor)))
+                {
+                    cursor = Other::Links(cursor)->next;
+
+                    return matched;
+                }
+
+                return !matched;
+            };
+        }
+
+        private:
+        // Nodes from node to the tail: walks forward and backward in step, so it costs the shorter side.
+        constexpr auto SuffixLength(T* node) const noexcept -> std::size_t
+        requires(HasLength && !HasLazyLength)
+        {
+            std::size_t steps {};
+            std::size_t count {};
+
+            for (T* front = node, * back = node;;)
+            {
+                steps++;
+
+                front = Links(front)->next;
+
+                if (!front)
+                {
+                    count = steps;
+
+                    break;
+                }
+
+                back = PrevOf(back);
+
+                if (!back)
+                {
+                    count = RecordLength::GetLength() - (steps - 1);
+
+                    break;
+                }
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnVisit(steps * 2);
+            }
+
+            return count;
+        }
+
+        private:
+        // With CompactHead the head's prev holds the tail; clears it so the chain ends in nullptr on both
+        // sides while it is relinked, SetEnds() puts it back.
+        constexpr void OpenChain () noexcept
+        {
+            if constexpr (HasCompactHead)
+            {
+                if (head)
+                {
+                    Links(head)->prev = nullptr;
+                }
+            }
+        }
+
+        // Exchanges the places of a and b (a before b) in an open chain.
+        static constexpr void SwapNodes(T* a, T* b) noexcept
+        {
+            T* aPrev = Links(a)->prev;
+            T* bNext = Links(b)->next;
+
+            if (Links(a)->next == b)
+            {
+                LinkBetween(aPrev, b, a);
+                LinkBetween(b, a, bNext);
+            }
+            else
+            {
+                T* aNext = Links(a)->next;
+                T* bPrev = Links(b)->prev;
+
+                LinkBetween(aPrev, b, aNext);
+                LinkBetween(bPrev, a, bNext);
+            }
+        }
+
+        private:
+        // First match from the front walk, or else the first match the back walk saw in the back half.
+        template<class Pred>
+        constexpr auto FindNode  (Pred pred) const noexcept -> T*
+        {
+            T* found {};
+
+            std::size_t visited {};
+
+            for (T* front = head, * back = GetTail(); front;)
+            {
+                T* frontNext = Links(front)->next;
+                T* backPrev  = Links(back )->prev;
+
+                detail::Prefetch(frontNext);
+                detail::Prefetch(backPrev );
+
+                visited++;
+
+                if (pred(*front))
+                {
+                    found = front;
+
+                    break;
+                }
+
+                if (front == back)
+                {
+                    break;
+                }
+
+                visited++;
+
+                if (pred(*back))
+                {
+                    found = back;
+                }
+
+                if (frontNext == back)
+                {
+                    break;
+                }
+
+                front = frontNext;
+                back  = backPrev;
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnVisit(visited);
+            }
+
+            return found;
+        }
+
+        private:
+        // Takes node out of the chain but leaves its own prev / next stale.
+        // Link / Cut do the work of InsertXUnlinked() and Unlink() without their probe,
+        // for the splice, merge and batch paths that fire one probe of their own.
+        constexpr void LinkPrev  (ForwardNodeIterator curNode, T* node) noexcept
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::LinkCore::InsertPrev(CoreEnds(), ToNode(curNode), node, LinkOffset(node));
+            }
+            else if (IsEmpty())
+            {
+                LinkBetween(nullptr, node, nullptr);
+
+                SetEnds(node, node);
+            }
+            else
+            {
+                T* cur  = ToNode(curNode);
+                T* tail = GetTail();
+
+                LinkBetween(PrevOf(cur), node, cur);
+
+                if (cur == head)
+                {
+                    SetEnds(node, tail);
+                }
+            }
+
+            Own(node, this);
+
+            OnLinkFingerprint(node);
+
+            if constexpr (Enable)
+            {
+                RecordLength::IncLength();
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnInsert(1, KnownLength());
+            }
+        }
+
+        constexpr void LinkNext  (ForwardNodeIterator curNode, T* node) noexcept
+        {
+            if (!std::is_constant_evaluated())
+            {
+                detail::LinkCore::InsertNext(CoreEnds(), ToNode(curNode), node, LinkOffset(node));
+            }
+            else if (IsEmpty())
+            {
+                LinkBetween(nullptr, node, nullptr);
+
+                SetEnds(node, node);
+            }
+            else
+            {
+                T* cur  = ToNode(curNode);
+                T* tail = GetTail();
+
+                LinkBetween(cur, node, Links(cur)->next);
+
+                if (cur == tail)
+                {
+                    SetEnds(head, node);
+                }
+            }
+
+            Own(node, this);
+
+            OnLinkFingerprint(node);
+
+            if constexpr (Enable)
+            {
+                RecordLength::IncLength();
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnInsert(1, KnownLength());
+            }
+        }
+
+        constexpr void Unlink    (T* node) noexcept
+        {
+            Cut(node);
+
+            U_AKR_PROBE(remove, this, ProbeNode(node), ProbeLength());
+        }
+
+        constexpr void Cut       (T* node) noexcept
+        {
+            OnUnlinkFingerprint(node);
+
+            if (!std::is_constant_evaluated())
+            {
+                detail::LinkCore::Unlink(CoreEnds(), node, LinkOffset(node));
+            }
+            else
+            {
+                T* prev = PrevOf(node);
+                T* next = Links(node)->next;
+                T* tail = GetTail();
+
+                if (prev)
+                {
+                    Links(prev)->next = next;
+                }
+                if (next)
+                {
+                    Links(next)->prev = prev;
+                }
+
+                SetEnds(node == head ? next : head, node == tail ? prev : tail);
+            }
+
+            Own(node, nullptr);
+
+            if constexpr (Enable)
+            {
+                RecordLength::DecLength();
+            }
+
+            if constexpr (HasStats)
+            {
+                RecordStats::OnRemove();
+            }
+        }
+
+        private:
+        static constexpr auto Links     (T* node) noexcept -> typename IntrusiveNode::LinkPair*
+        {
+            return &Hook::ToNode(node)->links;
+        }
+
+        static constexpr void LinkBetween(T* prev, T* node, T* next) noexcept
+        {
+            Links(node)->prev = prev;
+            Links(node)->next = next;
+
+            if (prev)
+            {
+                Links(prev)->next = node;
+            }
+            if (next)
+            {
+                Links(next)->prev = node;
+            }
+        }
+
+        // Fixes the neighbours only, node keeps its own prev / next. Does not know any list, so it
+        // is only used by Detach() for nodes that are not the head of a CompactHead list.
+        static constexpr void UnlinkNode(T* node) noexcept
+        {
+            T* prev = Links(node)->prev;
+            T* next = Links(node)->next;
+
+            if (prev)
+            {
+                Links(prev)->next = next;
+            }
+            if (next)
+            {
+                Links(next)->prev = prev;
+            }
+        }
+
+        static constexpr void Detach    (T* node) noexcept
+        {
+            if (!std::is_constant_evaluated())
+            {
+                return detail::LinkCore::Detach(node, LinkOffset(node));
+            }
+
+            UnlinkNode(node);
+
+            Links(node)->prev = nullptr;
+            Links(node)->next = nullptr;
+        }
+
+        // Takes node out of whatever it is linked into: through its owner with TrackOwner, which keeps
+        // that list's ends and length right, otherwise by its own links only.
+        static constexpr void Release   (T* node) noexcept
+        {
+            if constexpr (HasOwner)
+            {
+                if (auto owner = OwnerOf(node))
+                {
+                    owner->Unlink(node);
+                }
+            }
+            else
+            {
+                Detach(node);
+            }
+        }
+
+        private:
+        // node was just linked in, or is about to be unlinked; its neighbours are still in place
+        constexpr void OnLinkFingerprint  (T* node) noexcept
+        {
+            if constexpr (HasFingerprint)
+            {
+                Fingerprint::OnLinkFingerprint  (Fingerprint::HashBefore(PrevOf(node)), Fingerprint::HashAfter(node),
+                                                 Fingerprint::HashAfter(Links(node)->next));
+            }
+        }
+
+        constexpr void OnUnlinkFingerprint(T* node) noexcept
+        {
+            if constexpr (HasFingerprint)
+            {
+                Fingerprint::OnUnlinkFingerprint(Fingerprint::HashBefore(PrevOf(node)), Fingerprint::HashAfter(node),
+                                                 Fingerprint::HashAfter(Links(node)->next));
+            }
+        }
+
+        // After a range operation: dirty, or known again if the list ended up empty.
+        constexpr void OnRangeFingerprint () noexcept
+        {
+            if constexpr (HasFingerprint)
+            {
+                if (head)
+                {
+                    Fingerprint::MarkFingerprintDirty();
+                }
+                else
+                {
+                    Fingerprint::ResetFingerprint();
+                }
+            }
+        }
+
+        private:
+        // This list and node's links as LinkCore sees them.
+        U_AKR_INLINE constexpr auto CoreEnds() noexcept -> detail::LinkCore::Ends
+        {
+            if constexpr (HasCompactHead)
+            {
+                return { &head, nullptr };
+            }
+            else
+            {
+                return { &head, &last };
+            }
+        }
+
+        U_AKR_INLINE static auto LinkOffset(T* node) noexcept -> std::ptrdiff_t
+        {
+            static_assert(offsetof(typename IntrusiveNode::LinkPair, next) == sizeof(void*), "LinkCore reads next one pointer after prev");
+
+            return reinterpret_cast<char*>(Links(node)) - reinterpret_cast<char*>(node);
+        }
+
+        private:
+        static constexpr auto OwnerSlot (T* node) noexcept -> void*&
+        requires(HasOwner)
+        {
+            return static_cast<TrackedIntrusiveNode<T>*>(Hook::ToNode(node))->owner.list;
+        }
+
+        static constexpr void Own       (T* node, void* owner) noexcept
+        {
+            if constexpr (HasOwner)
+            {
+                OwnerSlot(node) = owner;
+            }
+
+            if constexpr (HasAutoUnlink)
+            {
+                static_cast<AutoUnlinkIntrusiveNode<T>*>(Hook::ToNode(node))->unlinker.unlink = &AutoUnlink;
+
+                if (!std::is_constant_evaluated())
+                {
+                    AutoUnlinkOffset(node);
+                }
+            }
+        }
+
+        // LinkOffset() measured once on a live node, every node of T has the same one. AutoUnlink() cannot
+        // measure it itself and only runs for nodes that went through Own() first.
+        static auto AutoUnlinkOffset(T* node = nullptr) noexcept -> std::ptrdiff_t
+        {
+            static const std::ptrdiff_t offset = LinkOffset(node);
+
+            return offset;
+        }
+
+        // Runs from ~AutoUnlinkIntrusiveNode, when T is already destroyed: node is never converted back to
+        // T*, the address the neighbours store is rebuilt from node's links and handed to LinkCore as is.
+        static void AutoUnlink(void* owner, IntrusiveNode* node) noexcept
+        {
+            auto list   = static_cast<IntrusiveList*>(owner);
+            auto offset = AutoUnlinkOffset();
+            auto self   = static_cast<void*>(reinterpret_cast<char*>(&node->links) - offset);
+
+            detail::LinkCore::Unlink(list->CoreEnds(), self, offset);
+
+            static_cast<TrackedIntrusiveNode<T>*>(node)->owner.list = nullptr;
+
+            // the destroyed node is not hashed again, the fingerprint is only marked dirty
+            list->OnRangeFingerprint();
+
+            if constexpr (Enable)
+            {
+                list->RecordLength::DecLength();
+            }
+
+            if constexpr (HasStats)
+            {
+                list->RecordStats::OnRemove();
+            }
+
+            U_AKR_PROBE(remove, list, static_cast<const void*>(self), list->ProbeLength());
+        }
+
+        // Points every node at *this again after the chain changed hands (move, Swap): O(n) with TrackOwner.
+        constexpr void OwnAll    () noexcept
+        {
+            if constexpr (HasOwner)
+            {
+                for (T* iter = head; iter; iter = Links(iter)->next)
+                {
+                    Own(iter, this);
+                }
+            }
+        }
+
+        private:
+        // The tail, which CompactHead keeps in head->prev.
+        U_AKR_INLINE constexpr auto GetTail   () const noexcept -> T*
+        {
+            if constexpr (HasCompactHead)
+            {
+                return head ? Links(head)->prev : nullptr;
+            }
+            else
+            {
+                return last;
+            }
+        }
+
+        // Publishes head and tail once the chain itself is final; with CompactHead this writes head->prev.
+        constexpr void SetEnds   (T* head_, T* last_) noexcept
+        {
+            head = head_;
+
+            if constexpr (HasCompactHead)
+            {
+                if (head_)
+                {
+                    Links(head_)->prev = last_;
+                }
+            }
+            else
+            {
+                last = last_;
+            }
+        }
+
+        // The node before node, nullptr for the head.
+        constexpr auto PrevOf    (T* node) const noexcept -> T*
+        {
+            if constexpr (HasCompactHead)
+            {
+                if (node == head)
+                {
+                    return nullptr;
+                }
+            }
+
+            return Links(node)->prev;
+        }
+
+        private:
+        // takes iterators and T* alike, the probe sites pass both
+        static constexpr auto ProbeNode(ForwardNodeIterator node) noexcept -> const void*
+        {
+            return node.operator->();
+        }
+
+        constexpr auto ProbeLength() const noexcept -> std::size_t
+        {
+            return KnownLength();
+        }
+
+        private:
+        // The length if it is known without a walk, Uncounted otherwise.
+        constexpr auto KnownLength() const noexcept -> std::size_t
+        {
+            if constexpr (HasLazyLength)
+            {
+                return RecordLength::IsLengthDirty() ? Uncounted : RecordLength::GetCachedLength();
+            }
+            else if constexpr (Enable)
+            {
+                return RecordLength::GetLength();
+            }
+            else
+            {
+                return Uncounted;
+            }
+        }
+    };
+
+#ifdef  D_AKR_ATOMIC_LIST
+    // Lock-free handoff point: any number of producers Push() nodes, one consumer takes the whole
+    // batch with TakeAll(). Only the node's next link is used while it sits here; prev links and
+    // push (FIFO) order are restored by the consumer in one walk over the batch.
+    template<class T, bool Enable = true, class... Policies>
+    requires(detail::Hookable<T, Policies...>)
+    struct AtomicIntrusiveList final
+    {
+        public:
+        using List                = IntrusiveList<T, Enable, Policies...>;
+
+        private:
+        using ForwardNodeIterator = typename List::ForwardNodeIterator;
+
+        private:
+        std::atomic<T*> top {};
+
+        public:
+        constexpr AtomicIntrusiveList() = default;
+
+        AtomicIntrusiveList(const AtomicIntrusiveList&) = delete;
+
+        public:
+        auto IsEmpty() const noexcept -> bool
+        {
+            return !top.load(std::memory_order_relaxed);
+        }
+
+        // newNode must not be linked into any list.
+        void Push   (ForwardNodeIterator newNode) noexcept
+        {
+            T* node = List::ToNode(newNode);
+            T* next = top.load(std::memory_order_relaxed);
+
+            do
+            {
+                List::Links(node)->next = next;
+            }
+            while (!top.compare_exchange_weak(next, node, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        auto TakeAll() noexcept -> List
+        {
+            List list;
+
+            T* chain = top.exchange(nullptr, std::memory_order_acquire);
+
+            if (!chain)
+            {
+                return list;
+            }
+
+            T* first {};
+
+            std::size_t count {};
+
+            for (T* iter = chain, * next; iter; iter = next)
+            {
+                next = List::Links(iter)->next;
+
+                List::Links(iter)->next = first;
+
+                List::Own(iter, &list);
+
+                if (first)
+                {
+                    List::Links(first)->prev = iter;
+                }
+
+                first = iter;
+
+                count++;
+            }
+
+            List::Links(first)->prev = nullptr;
+
+            list.SetEnds(first, chain);
+
+            list.OnRangeFingerprint();
+
+            if constexpr (Enable)
+            {
+                list.List::RecordLength::AddLength(count);
+            }
+
+            if constexpr (List::HasStats)
+            {
+                list.List::RecordStats::OnInsert(count, list.KnownLength());
+            }
+
+            return list;
+        }
+    };
+
+#endif//D_AKR_ATOMIC_LIST
+
+    // Describes a foreign link layout, e.g. a Linux-style
+    //     struct list_head { struct list_head* next; struct list_head* prev; };
+    // embedded in T as Member, with its next / prev fields named by Next / Prev.
+    // T must be constant-initialisable from {}, as C structs are: the offset of Member is measured on a
+    // constexpr T, since offsetof only accepts member names.
+    template<auto Member, auto Next, auto Prev>
+    struct ForeignHook
+    {
+        using Value = typename detail::MemberClass<decltype(Member)>::Type;
+        using Link  = typename detail::MemberType <decltype(Member)>::Type;
+
+        private:
+        static constexpr Value Probe {};
+
+        public:
+        static constexpr auto ToLink (Value* value) noexcept -> Link*
+        {
+            return __builtin_addressof(value->*Member);
+        }
+
+        // container_of, with the offset of Member taken from Probe; it folds to a constant.
+        static           auto ToValue(Link*  link ) noexcept -> Value*
+        {
+            auto offset = reinterpret_cast<const unsigned char*>(__builtin_addressof(Probe.*Member)) -
+                          reinterpret_cast<const unsigned char*>(__builtin_addressof(Probe));
+
+            return reinterpret_cast<Value*>(reinterpret_cast<unsigned char*>(link) - offset);
+        }
+
+        static constexpr auto GetNext(Link*  link ) noexcept -> Link*&
+        {
+            return link->*Next;
+        }
+
+        static constexpr auto GetPrev(Link*  link ) noexcept -> Link*&
+        {
+            return link->*Prev;
+        }
+    };
+
+    // IntrusiveList-style API over a circular list with a sentinel that someone else owns (C code,
+    // kernel-style list_head). The view keeps no state besides the sentinel pointer, so both sides may
+    // mutate the list in between calls; GetLength() therefore walks.
+    template<class Hook>
+    struct CircularListView final
+    {
+        private:
+        using T    = typename Hook::Value;
+        using Link = typename Hook::Link;
+
+        private:
+        template<class U, bool IsConst>
+        struct IteratorBase
+        {
+            public:
+            using difference_type   = std::ptrdiff_t;
+            using value_type        = T;
+            using pointer           = std::conditional_t<IsConst, const T*, T*>;
+            using reference         = std::conditional_t<IsConst, const T&, T&>;
+            using iterator_category = std::bidirectional_iterator_tag;
+
+            protected:
+            Link* link {};
+
+            public:
+            constexpr IteratorBase() = default;
+
+            constexpr IteratorBase(Link* link_) noexcept:
+                link { link_ }
+            {
+            }
+
+            public:
+            auto operator->() const noexcept -> pointer
+            {
+                return  Hook::ToValue(link);
+            }
+
+            auto operator* () const noexcept -> reference
+            {
+                return *Hook::ToValue(link);
+            }
+
+            public:
+            constexpr auto operator++(   ) noexcept -> U&
+            {
+                link = Hook::GetNext(link);
+
+                return *static_cast<U*>(this);
+            }
+            constexpr auto operator++(int) noexcept -> U
+            {
+                U tmp(*static_cast<U*>(this));
+
+                ++*this;
+
+                return tmp;
+            }
+
+            constexpr auto operator--(   ) noexcept -> U&
+            {
+                link = Hook::GetPrev(link);
+
+                return *static_cast<U*>(this);
+            }
+            constexpr auto operator--(int) noexcept -> U
+            {
+                U tmp(*static_cast<U*>(this));
+
+                --*this;
+
+                return tmp;
+            }
+
+            public:
+            friend constexpr auto operator==(const U& lhs, const U& rhs) noexcept -> bool
+            {
+                return lhs.link == rhs.link;
+            }
+        };
+
+        public:
+        struct Iterator      final: IteratorBase<Iterator, false>
+        {
+            friend struct CircularListView;
+
+            public:
+            using IteratorBase<Iterator, false>::IteratorBase;
+        };
+
+        static_assert(std::bidirectional_iterator<Iterator>);
+
+        struct ConstIterator final: IteratorBase<ConstIterator, true>
+        {
+            public:
+            using IteratorBase<ConstIterator, true>::IteratorBase;
+
+            public:
+            constexpr ConstIterator(const Iterator& iter) noexcept:
+                IteratorBase<ConstIterator, true>(iter.link)
+            {
+            }
+        };
+
+        static_assert(std::bidirectional_iterator<ConstIterator>);
+
+        private:
+        Link* sentinel {};
+
+        public:
+        constexpr explicit CircularListView(Link* sentinel_) noexcept:
+            sentinel { sentinel_ }
+        {
+        }
+
+        public:
+        // INIT_LIST_HEAD: makes the sentinel an empty list, forgetting any nodes on it.
+        constexpr void Init      () noexcept
+        {
+            Hook::GetNext(sentinel) = sentinel;
+            Hook::GetPrev(sentinel) = sentinel;
+        }
+
+        public:
+        constexpr auto begin     () const noexcept -> Iterator
+        {
+            return Hook::GetNext(sentinel);
+        }
+        constexpr auto end       () const noexcept -> Iterator
+        {
+            return sentinel;
+        }
+
+        constexpr auto rbegin    () const noexcept
+        {
+            return std::reverse_iterator<Iterator>(end  ());
+        }
+        constexpr auto rend      () const noexcept
+        {
+            return std::reverse_iterator<Iterator>(begin());
+        }
+
+        constexpr auto cbegin    () const noexcept -> ConstIterator
+        {
+            return begin();
+        }
+        constexpr auto cend      () const noexcept -> ConstIterator
+        {
+            return end  ();
+        }
+
+        public:
+        auto GetHead   () const noexcept -> T*
+        {
+            return IsEmpty() ? nullptr : Hook::ToValue(Hook::GetNext(sentinel));
+        }
+
+        auto GetLast   () const noexcept -> T*
+        {
+            return IsEmpty() ? nullptr : Hook::ToValue(Hook::GetPrev(sentinel));
+        }
+
+        constexpr auto IsEmpty   () const noexcept -> bool
+        {
+            return Hook::GetNext(sentinel) == sentinel;
+        }
+
+        constexpr auto GetLength () const noexcept -> std::size_t
+        {
+            std::size_t length {};
+
+            for (Link* iter = Hook::GetNext(sentinel); iter != sentinel; iter = Hook::GetNext(iter))
+            {
+                length++;
+            }
+
+            return length;
+        }
+
+        public:
+        // newNode must not be linked into any list.
+        auto InsertPrev(T* curNode, T* newNode) noexcept -> T*
+        {
+            LinkBefore(Hook::ToLink(curNode), Hook::ToLink(newNode));
+
+            return newNode;
+        }
+
+        auto InsertNext(T* curNode, T* newNode) noexcept -> T*
+        {
+            LinkBefore(Hook::GetNext(Hook::ToLink(curNode)), Hook::ToLink(newNode));
+
+            return newNode;
+        }
+
+        auto InsertHead(T* newNode) noexcept -> T*
+        {
+            LinkBefore(Hook::GetNext(sentinel), Hook::ToLink(newNode));
+
+            return newNode;
+        }
+
+        auto InsertLast(T* newNode) noexcept -> T*
+        {
+            LinkBefore(sentinel, Hook::ToLink(newNode));
+
+            return newNode;
+        }
+
+        public:
+        void Remove    (T* curNode) noexcept
+        {
+            Unlink(Hook::ToLink(curNode));
+        }
+
+        void RemoveHead() noexcept
+        {
+            Unlink(Hook::GetNext(sentinel));
+        }
+
+        void RemoveLast() noexcept
+        {
+            Unlink(Hook::GetPrev(sentinel));
+        }
+
+        // Returns the iterator after curNode.
+        auto Erase     (Iterator curNode) noexcept -> Iterator
+        {
+            Link* next = Hook::GetNext(curNode.link);
+
+            Unlink(curNode.link);
+
+            return next;
+        }
+
+        private:
+        // Links node in front of next.
+        static constexpr void LinkBefore(Link* next, Link* node) noexcept
+        {
+            Link* prev = Hook::GetPrev(next);
+
+            Hook::GetNext(node) = next;
+            Hook::GetPrev(node) = prev;
+            Hook::GetNext(prev) = node;
+            Hook::GetPrev(next) = node;
+        }
+
+        static constexpr void Unlink    (Link* node) noexcept
+        {
+            Link* prev = Hook::GetPrev(node);
+            Link* next = Hook::GetNext(node);
+
+            Hook::GetNext(prev) = next;
+            Hook::GetPrev(next) = prev;
+
+            // list_del_init: the node is left as an empty list of its own, which C code can test and unlink again
+            Hook::GetNext(node) = node;
+            Hook::GetPrev(node) = node;
+        }
+    };
+}
+
+#ifdef  D_AKR_TEST
+#if !defined(D_AKR_STATS) || !defined(D_AKR_ATOMIC_LIST)
+#error "the inline tests cover the opt-in parts too, define D_AKR_STATS and D_AKR_ATOMIC_LIST with D_AKR_TEST"
+#endif
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace akr::test
+{
+    AKR_TEST(IntrusiveList,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
+
+            Test(int value_) noexcept:
+                value { value_ }
+            {
+            }
+
+            auto operator<=>(const Test&) const = default;
+        };
+
+        IntrusiveList<Test> list;
+        std::vector  <Test*> vec;
+
+        assert(list.IsEmpty());
+        assert(list.GetLength() == 0);
+
+        auto p = list.GetHead();
+        assert(!p);
+
+        auto v1 = Test(1);
+        auto v2 = Test(2);
+        auto v3 = Test(3);
+
+        list.InsertLast(&v1);
+        list.InsertLast(&v2);
+        list.InsertLast(&v3);
+
+        assert(list.IsEmpty() == false);
+        assert(list.GetLength() == 3);
+
+        assert(list.GetHead() == &v1);
+        assert(list.GetLast() == &v3);
+
+        p = list.GetHead();
+        vec.push_back(&*p);
+        assert(p == &v1);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v2);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v3);
+
+        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        vec.clear();
+
+        list.Remove(&v2);
+
+        assert(list.IsEmpty() == false);
+        assert(list.GetLength() == 2);
+
+        assert(list.GetHead() == &v1);
+        assert(list.GetLast() == &v3);
+
+        p = list.GetHead();
+        vec.push_back(&*p);
+        assert(p == &v1);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v3);
+
+        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        vec.clear();
+
+        auto v4 = Test(4);
+        auto v5 = Test(5);
+
+        list.InsertPrev(list.GetHead(), &v4);
+        list.InsertPrev(list.GetLast(), &v5);
+
+        assert(list.IsEmpty() == false);
+        assert(list.GetLength() == 4);
+
+        assert(list.GetHead() == &v4);
+        assert(list.GetLast() == &v3);
+
+        p = list.GetHead();
+        vec.push_back(&*p);
+        assert(p == &v4);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v1);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v5);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v3);
+
+        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        vec.clear();
+
+        list.RemoveHead();
+        list.RemoveLast();
+
+        assert(list.IsEmpty() == false);
+        assert(list.GetLength() == 2);
+
+        assert(list.GetHead() == &v1);
+        assert(list.GetLast() == &v5);
+
+        auto v6 = Test(6);
+        auto v7 = Test(7);
+
+        list.InsertNext(list.GetHead(), &v6);
+        list.InsertNext(list.GetLast(), &v7);
+
+        assert(list.IsEmpty() == false);
+        assert(list.GetLength() == 4);
+
+        assert(list.GetHead() == &v1);
+        assert(list.GetLast() == &v7);
+
+        p = list.GetHead();
+        vec.push_back(&*p);
+        assert(p == &v1);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v6);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v5);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v7);
+
+        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        list.Clear();
+        assert(list.IsEmpty());
+        assert(list.GetLength() == 0);
+
+        vec.clear();
+
+        auto v8 = Test(8);
+        auto v9 = Test(9);
+        auto v0 = Test(0);
+
+        list.InsertHead(&v8);
+        list.InsertHead(&v9);
+        list.InsertHead(&v0);
+
+        assert(list.IsEmpty() == false);
+        assert(list.GetLength() == 3);
+
+        assert(list.GetHead() == &v0);
+        assert(list.GetLast() == &v8);
+
+        p = list.GetHead();
+        vec.push_back(&*p);
+        assert(p == &v0);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v9);
+        ++p;
+        vec.push_back(&*p);
+        assert(p == &v8);
+
+        assert(std::equal(list.  begin(), list.  end(), vec.  begin(), vec.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. rbegin(), list. rend(), vec. rbegin(), vec. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list. cbegin(), list. cend(), vec. cbegin(), vec. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list.crbegin(), list.crend(), vec.crbegin(), vec.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        vec.clear();
+
+        IntrusiveList<Test> list1;
+        std::vector  <Test*> vec1;
+
+        IntrusiveList<Test> list2;
+        std::vector  <Test*> vec2;
+
+        assert(list1 == list2);
+
+        list1.InsertLast(&v1);
+        list1.InsertLast(&v2);
+        list1.InsertLast(&v3);
+        list1.InsertLast(&v4);
+        list1.InsertLast(&v5);
+
+        list2.InsertLast(&v6);
+        list2.InsertLast(&v7);
+        list2.InsertLast(&v8);
+        list2.InsertLast(&v9);
+        list2.InsertLast(&v0);
+
+        list1.InsertPrev(&v2, &v9, list2);
+        list1.InsertLast(&v8, list2);
+
+        assert(list1.IsEmpty() == false);
+        assert(list1.GetLength() == 7);
+
+        assert(list2.IsEmpty() == false);
+        assert(list2.GetLength() == 3);
+
+        assert(list1 != list2);
+        assert(list1 <  list2);
+        assert(list1 <= list2);
+
+        vec1.push_back  (&v1);
+        vec1.push_back  (&v9);
+        vec1.push_back  (&v2);
+        vec1.push_back  (&v3);
+        vec1.push_back  (&v4);
+        vec1.push_back  (&v5);
+        vec1.push_back  (&v8);
+
+        vec2.push_back  (&v6);
+        vec2.push_back  (&v7);
+        vec2.push_back  (&v0);
+
+        assert(std::equal(list1.  begin(), list1.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list1. rbegin(), list1. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list1. cbegin(), list1. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list1.crbegin(), list1.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        assert(std::equal(list2.  begin(), list2.  end(), vec2.  begin(), vec2.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list2. rbegin(), list2. rend(), vec2. rbegin(), vec2. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list2. cbegin(), list2. cend(), vec2. cbegin(), vec2. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list2.crbegin(), list2.crend(), vec2.crbegin(), vec2.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        vec1.clear();
+        vec2.clear();
+
+        list2.InsertNext(&v7, &v4, list1);
+        list2.InsertHead(&v3, list1);
+
+        assert(list1.IsEmpty() == false);
+        assert(list1.GetLength() == 5);
+
+        assert(list2.IsEmpty() == false);
+        assert(list2.GetLength() == 5);
+
+        assert(list1 != list2);
+        assert(list1 <  list2);
+        assert(list1 <= list2);
+
+        vec1.push_back  (&v1);
+        vec1.push_back  (&v9);
+        vec1.push_back  (&v2);
+        vec1.push_back  (&v5);
+        vec1.push_back  (&v8);
+
+        vec2.push_back  (&v3);
+        vec2.push_back  (&v6);
         vec2.push_back  (&v7);
+        vec2.push_back  (&v4);
         vec2.push_back  (&v0);
 
-        assert(std::equal(list1.  begin(), list1.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list1. rbegin(), list1. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list1. cbegin(), list1. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list1.crbegin(), list1.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+        assert(std::equal(list1.  begin(), list1.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list1. rbegin(), list1. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list1. cbegin(), list1. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list1.crbegin(), list1.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        assert(std::equal(list2.  begin(), list2.  end(), vec2.  begin(), vec2.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list2. rbegin(), list2. rend(), vec2. rbegin(), vec2. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list2. cbegin(), list2. cend(), vec2. cbegin(), vec2. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list2.crbegin(), list2.crend(), vec2.crbegin(), vec2.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        auto list3 = std::move(list1);
+
+        assert(list1.IsEmpty());
+        assert(list1.GetLength() == 0);
+        assert(list3.IsEmpty() == false);
+        assert(list3.GetLength() == 5);
+
+        assert(std::equal(list3.  begin(), list3.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list3. rbegin(), list3. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list3. cbegin(), list3. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list3.crbegin(), list3.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        IntrusiveList<Test> list4;
+        list4 = std::move(list2);
+
+        assert(list2.IsEmpty());
+        assert(list2.GetLength() == 0);
+        assert(list4.IsEmpty() == false);
+        assert(list4.GetLength() == 5);
+
+        assert(std::equal(list4.  begin(), list4.  end(), vec2.  begin(), vec2.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list4. rbegin(), list4. rend(), vec2. rbegin(), vec2. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list4. cbegin(), list4. cend(), vec2. cbegin(), vec2. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list4.crbegin(), list4.crend(), vec2.crbegin(), vec2.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        assert(list3 != list4);
+        assert(list3 <  list4);
+        assert(list3 <= list4);
+
+        IntrusiveList<Test> list5;
+        list5 += std::move(list3);
+
+        assert(list3.IsEmpty());
+        assert(list3.GetLength() == 0);
+        assert(list5.IsEmpty() == false);
+        assert(list5.GetLength() == 5);
+
+        assert(std::equal(list5.  begin(), list5.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list5. rbegin(), list5. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list5. cbegin(), list5. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list5.crbegin(), list5.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        auto list6 = std::move(list5) + std::move(list4);
+
+        assert(list4.IsEmpty());
+        assert(list4.GetLength() == 0);
+        assert(list6.IsEmpty() == false);
+        assert(list6.GetLength() == 10);
+
+        vec1.insert(vec1.end(), vec2.begin(), vec2.end());
+
+        assert(std::equal(list6.  begin(), list6.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list6. rbegin(), list6. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list6. cbegin(), list6. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list6.crbegin(), list6.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        list5.Clear();
+        assert(list5.IsEmpty());
+        assert(list5.GetLength() == 0);
+
+        list6.Clear();
+        assert(list6.IsEmpty());
+        assert(list6.GetLength() == 0);
+
+        vec1.clear();
+        vec2.clear();
+    })
+
+    AKR_TEST(Transfer,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
+
+            Test(int value_) noexcept:
+                value { value_ }
+            {
+            }
+        };
+
+        IntrusiveList<Test> ready;
+        IntrusiveList<Test> waiting;
+
+        auto v1 = Test(1);
+        auto v2 = Test(2);
+        auto v3 = Test(3);
+        auto v4 = Test(4);
+
+        ready.InsertLastUnlinked(&v1);
+        ready.InsertLastUnlinked(&v2);
+        ready.InsertHeadUnlinked(&v3);
+        ready.InsertNextUnlinked(&v3, &v4);
+
+        assert(ready.GetLength() == 4);
+        assert(ready.GetHead() == &v3);
+        assert(ready.GetLast() == &v2);
+
+        waiting.TransferLast(&v3, ready);
+        waiting.TransferHead(&v2, ready);
+        waiting.TransferNext(&v2, &v1, ready);
+        waiting.TransferPrev(&v2, &v4, ready);
+
+        assert(ready.IsEmpty());
+        assert(ready.GetLength() == 0);
+
+        assert(waiting.GetLength() == 4);
+        assert(waiting.GetHead() == &v4);
+        assert(waiting.GetLast() == &v3);
+
+        std::vector<Test*> vec;
+
+        vec.push_back(&v4);
+        vec.push_back(&v2);
+        vec.push_back(&v1);
+        vec.push_back(&v3);
+
+        assert(std::equal(waiting. begin(), waiting. end(), vec. begin(), vec. end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(waiting.rbegin(), waiting.rend(), vec.rbegin(), vec.rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        waiting.TransferLast(&v2, waiting);
+
+        assert(waiting.GetLength() == 4);
+        assert(waiting.GetHead() == &v4);
+        assert(waiting.GetLast() == &v2);
+    })
+
+    AKR_TEST(RemoveIf,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
+        };
+
+        IntrusiveList<Test> list;
+        std::vector  <Test*> vec;
+
+        Test nodes[10];
+
+        for (int i = 0; i < 10; i++)
+        {
+            nodes[i].value = i;
+
+            list.InsertLast(&nodes[i]);
+        }
+
+        for (auto iter = list.begin(); iter != list.end();)
+        {
+            iter = iter->value == 0 || iter->value == 5 ? list.Erase(iter) : ++iter;
+        }
+
+        assert(list.GetLength() == 8);
+        assert(list.GetHead() == &nodes[1]);
+
+        auto iter = list.EraseRange(&nodes[2], &nodes[4]);
+        assert(iter == &nodes[4]);
+        assert(list.GetLength() == 6);
+
+        list.EraseRange(&nodes[8], list.end());
+        assert(list.GetLength() == 4);
+        assert(list.GetLast() == &nodes[7]);
+
+        for (auto&& e : list)
+        {
+            vec.push_back(&e);
+        }
+        list.InsertLast(&nodes[0]);
+        list.InsertLast(&nodes[9]);
+        vec .push_back (&nodes[0]);
+        vec .push_back (&nodes[9]);
+
+        // 1 4 6 7 0 9
+        int disposed {};
+
+        auto removed = list.RemoveIfAndDispose([](auto&& e)
+                                               {
+                                                   return e.value == 1 || e.value == 6 || e.value == 9;
+                                               },
+                                               [&](Test* e)
+                                               {
+                                                   disposed += e->value;
+                                               });
+
+        assert(removed  == 3);
+        assert(disposed == 16);
+        assert(list.GetLength() == 3);
+        assert(list.GetHead() == &nodes[4]);
+        assert(list.GetLast() == &nodes[0]);
+
+        std::erase_if(vec, [](auto&& e)
+                      {
+                          return e->value == 1 || e->value == 6 || e->value == 9;
+                      });
+
+        assert(std::equal(list. begin(), list. end(), vec. begin(), vec. end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list.rbegin(), list.rend(), vec.rbegin(), vec.rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        assert(list.RemoveIf([](auto&&)
+                             {
+                                 return true;
+                             }) == 3);
+        assert(list.IsEmpty());
+        assert(list.GetLength() == 0);
+    })
+
+    AKR_TEST(ClearAndDispose,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
+        };
+
+        IntrusiveList<Test> list1;
+        IntrusiveList<Test> list2;
+
+        Test nodes[6];
+
+        for (int i = 0; i < 6; i++)
+        {
+            nodes[i].value = i;
+
+            list1.InsertLast(&nodes[i]);
+        }
+
+        int disposed {};
+
+        list1.ClearAndDispose([&](Test* e)
+                              {
+                                  disposed += e->value;
+                              });
+
+        assert(disposed == 15);
+        assert(list1.IsEmpty());
+        assert(list1.GetLength() == 0);
+
+        // reinserting after a proper clear must not write through stale links
+        list2.InsertLast(&nodes[0]);
+        list2.InsertLast(&nodes[5]);
+        list2.InsertLast(&nodes[3]);
+
+        assert(list2.GetHead() == &nodes[0]);
+        assert(list2.GetLast() == &nodes[3]);
+        assert(std::distance(list2.begin(), list2.end()) == 3);
+
+        list2.Clear();
+
+        list1.InsertLast(&nodes[5]);
+        list1.InsertLast(&nodes[1]);
+
+        assert(std::distance(list1.begin(), list1.end()) == 2);
+        assert(list1.GetHead() == &nodes[5]);
+        assert(list1.GetLast() == &nodes[1]);
+
+        list1.ClearUnsafe();
+
+        assert(list1.IsEmpty());
+        assert(list1.GetLength() == 0);
+
+        for (auto&& e : nodes)
+        {
+            list2.InsertLastUnlinked(&e);
+        }
+
+        assert(list2.GetLength() == 6);
+        assert(std::distance(list2.begin(), list2.end()) == 6);
+
+        list2.Clear();
+
+        // after ClearUnsafe() nodes[0] still links to nodes[1]: InsertLast(&nodes[0]) would detach it and clear
+        // nodes[1]->prev inside list2, the unlinked insert only overwrites nodes[0]'s own links
+        list1.InsertLast(&nodes[0]);
+        list1.InsertLast(&nodes[1]);
+        list1.InsertLast(&nodes[2]);
+        list1.ClearUnsafe();
+
+        list2.InsertLast(&nodes[4]);
+        list2.InsertLastUnlinked(&nodes[1]);
+        list1.InsertLastUnlinked(&nodes[0]);
+
+        // constructed anew the node has no links left, the plain insert is safe again
+        nodes[2] = Test {};
+        nodes[2].value = 2;
+        list1.InsertLast(&nodes[2]);
+
+        assert(list2.GetHead() == &nodes[4]);
+        assert(list2.GetLast() == &nodes[1]);
+        assert(std::distance(list2.rbegin(), list2.rend()) == 2);
+        assert(std::distance(list1.rbegin(), list1.rend()) == 2);
+        assert(list1.GetHead() == &nodes[0]);
+        assert(list1.GetLast() == &nodes[2]);
+    })
+
+    AKR_TEST(Drain,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
+        };
+
+        IntrusiveList<Test> list1;
+        IntrusiveList<Test> list2;
+
+        Test nodes[6];
+
+        for (int i = 0; i < 6; i++)
+        {
+            nodes[i].value = i;
+
+            list1.InsertLast(&nodes[i]);
+        }
+
+        Test* stopped {};
+
+        for (auto&& e : list1.Drain())
+        {
+            if (e.value == 3)
+            {
+                stopped = &e;
+
+                break;
+            }
+
+            list2.InsertHeadUnlinked(&e);
+        }
+
+        // the node the body broke out on is already off the list and comes back through the caller
+        assert(list1.GetLength() == 2);
+        assert(list1.GetHead() == &nodes[4]);
+        assert(list1.GetLast() == &nodes[5]);
+        assert(std::distance(list1.rbegin(), list1.rend()) == 2);
+
+        list1.InsertHeadUnlinked(stopped);
+        assert(list1.GetLength() == 3);
+        assert(list1.GetHead() == &nodes[3]);
+        assert(std::distance(list1.rbegin(), list1.rend()) == 3);
+
+        // a range that is never iterated leaves the list alone
+        {
+            [[maybe_unused]] auto untouched = list1.Drain();
+        }
+
+        assert(list1.GetLength() == 3);
+        assert(list1.GetHead() == &nodes[3]);
+        assert(std::distance(list1.rbegin(), list1.rend()) == 3);
+
+        assert(list2.GetLength() == 3);
+        assert(list2.GetHead() == &nodes[2]);
+        assert(list2.GetLast() == &nodes[0]);
+
+        int sum {};
+
+        for (auto&& e : list1.Drain())
+        {
+            sum += e.value;
+
+            list2.InsertLast(&e);
+        }
+
+        assert(sum == 12);
+        assert(list1.IsEmpty());
+        assert(list1.GetLength() == 0);
+
+        assert(list2.GetLength() == 6);
+        assert(list2.GetLast() == &nodes[5]);
+        assert(std::distance(list2. begin(), list2. end()) == 6);
+        assert(std::distance(list2.rbegin(), list2.rend()) == 6);
+
+        for ([[maybe_unused]] auto&& e : list1.Drain())
+        {
+            assert(false);
+        }
+    })
+
+    AKR_TEST(TakeAll,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
+        };
+
+        IntrusiveList<Test> list1;
+        IntrusiveList<Test> list2;
+
+        Test nodes[5];
+
+        for (int i = 0; i < 5; i++)
+        {
+            nodes[i].value = i;
+
+            (i < 3 ? list1 : list2).InsertLast(&nodes[i]);
+        }
+
+        list1.Swap(list2);
+
+        assert(list1.GetLength() == 2);
+        assert(list1.GetHead() == &nodes[3]);
+        assert(list2.GetLength() == 3);
+        assert(list2.GetHead() == &nodes[0]);
+
+        swap(list1, list2);
+
+        auto list3 = list1.TakeAll();
+
+        assert(list1.IsEmpty());
+        assert(list1.GetLength() == 0);
+        assert(list3.GetLength() == 3);
+        assert(list3.GetLast() == &nodes[2]);
+
+        list3.Clear();
+        list2.Clear();
+
+        AtomicIntrusiveList<Test> inbox;
+
+        assert(inbox.IsEmpty());
+        assert(inbox.TakeAll().IsEmpty());
+
+        for (auto&& e : nodes)
+        {
+            inbox.Push(&e);
+        }
+
+        auto batch = inbox.TakeAll();
+
+        assert(inbox.IsEmpty());
+        assert(batch.GetLength() == 5);
+        assert(batch.GetHead() == &nodes[0]);
+        assert(batch.GetLast() == &nodes[4]);
+
+        int value {};
+
+        for (auto&& e : batch)
+        {
+            assert(e.value == value++);
+        }
+        for (auto iter = batch.rbegin(); iter != batch.rend(); ++iter)
+        {
+            assert(iter->value == --value);
+        }
+    })
+
+    AKR_TEST(InsertRange,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
+        };
+
+        IntrusiveList<Test> list;
+        std::vector  <Test*> vec;
+
+        Test nodes[8];
+
+        for (int i = 0; i < 8; i++)
+        {
+            nodes[i].value = i;
+        }
+
+        list.InsertRangeLast(nodes + 2, nodes + 4);
+        list.InsertRangePrev(list.GetHead(), nodes, nodes + 2);
+
+        vec.push_back(&nodes[5]);
+        vec.push_back(&nodes[4]);
+
+        list.InsertRangePrev(&nodes[3], vec.begin(), vec.end());
+        list.InsertRangeLast(vec.end(), vec.end());
+
+        assert(list.GetLength() == 6);
+        assert(list.GetHead() == &nodes[0]);
+        assert(list.GetLast() == &nodes[3]);
+
+        vec.clear();
+
+        for (int i : { 0, 1, 2, 5, 4, 3 })
+        {
+            vec.push_back(&nodes[i]);
+        }
+
+        assert(std::equal(list. begin(), list. end(), vec. begin(), vec. end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list.rbegin(), list.rend(), vec.rbegin(), vec.rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        IntrusiveList<Test> chain;
+        chain.InsertLast(&nodes[6]);
+        chain.InsertLast(&nodes[7]);
+
+        auto chainHead = chain.GetHead();
+        auto chainLast = chain.GetLast();
+        chain.ClearUnsafe();
+
+        list.AdoptChain(chainHead, chainLast, 2);
+
+        assert(list.GetLength() == 8);
+        assert(list.GetLast() == &nodes[7]);
+        assert(std::distance(list.rbegin(), list.rend()) == 8);
+
+        list.Clear();
+
+        list.AdoptChain(chainHead, chainHead, 1);
+
+        assert(list.GetLength() == 1);
+        assert(list.GetHead() == &nodes[6]);
+        assert(list.GetLast() == &nodes[6]);
+        assert(std::distance(list.begin(), list.end()) == 1);
+    })
+
+    AKR_TEST(Batch,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
+        };
+
+        IntrusiveList<Test> list;
+        std::vector  <Test*> vec;
+
+        Test nodes[6];
+
+        for (int i = 0; i < 6; i++)
+        {
+            nodes[i].value = i;
+        }
+
+        list.InsertLast(&nodes[0]);
+        list.InsertLast(&nodes[1]);
+
+        {
+            auto batch = list.BeginBatch();
+
+            batch.InsertLast(&nodes[2]);
+            batch.InsertHead(&nodes[3]);
+            batch.RemoveLast();
+            batch.InsertNext(&nodes[0], &nodes[4]);
+            batch.Remove(&nodes[1]);
+            batch.InsertPrev(&nodes[0], &nodes[5]);
+
+            // not published yet
+            assert(list.GetLength() == 2);
+            assert(list.GetHead() == &nodes[0]);
+
+            assert(batch.GetHead() == &nodes[3]);
+            assert(batch.GetLast() == &nodes[4]);
+            assert(std::distance(batch.begin(), batch.end()) == 4);
+        }
+
+        assert(list.GetLength() == 4);
+        assert(list.GetHead() == &nodes[3]);
+        assert(list.GetLast() == &nodes[4]);
+
+        for (int i : { 3, 5, 0, 4 })
+        {
+            vec.push_back(&nodes[i]);
+        }
+
+        assert(std::equal(list. begin(), list. end(), vec. begin(), vec. end(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+        assert(std::equal(list.rbegin(), list.rend(), vec.rbegin(), vec.rend(), [](auto&& e1, auto&& e2)
+                          {
+                              return e1.value == e2->value;
+                          }));
+
+        {
+            auto batch = list.BeginBatch();
+
+            while (!batch.IsEmpty())
+            {
+                batch.RemoveHead();
+            }
+
+            batch.Commit();
+
+            assert(list.IsEmpty());
+            assert(list.GetLength() == 0);
+
+            batch.InsertLast(&nodes[1]);
+        }
+
+        assert(list.GetLength() == 1);
+        assert(list.GetHead() == &nodes[1]);
+        assert(list.GetLast() == &nodes[1]);
+    })
+
+    struct HookTest
+    {
+        int value {};
+
+        IntrusiveNode<HookTest> hook1;
+        IntrusiveNode<HookTest> hook2;
+
+        auto operator<=>(const HookTest&) const = default;
+    };
+
+    using HookList1 = IntrusiveList<HookTest, true, MemberHook<&HookTest::hook1>>;
+    using HookList2 = IntrusiveList<HookTest, true, MemberHook<&HookTest::hook2>, RecordStats<true>>;
+
+    AKR_TEST(MemberHook,
+    {
+        static_assert( detail::Hookable<HookTest, MemberHook<&HookTest::hook1>>);
+        static_assert(!detail::Hookable<HookTest>);
+
+        HookList1 list1;
+        HookList2 list2;
+
+        HookTest nodes[4];
+
+        for (int i = 0; i < 4; i++)
+        {
+            nodes[i].value = i;
+
+            list1.InsertLast(&nodes[i]);
+            list2.InsertHead(&nodes[i]);
+        }
+
+        assert(list1.GetLength() == 4);
+        assert(list2.GetLength() == 4);
+
+        int expect = 0;
+        for (auto&& e : list1)
+        {
+            assert(e.value == expect++);
+        }
+        for (auto&& e : list2)
+        {
+            assert(e.value == --expect);
+        }
+
+        list1.Remove(&nodes[1]);
+        list2.Remove(&nodes[2]);
+
+        assert(list1.GetLength() == 3);
+        assert(list2.GetLength() == 3);
+        assert(std::next(list1.begin())->value == 2);
+        assert(std::next(list2.begin())->value == 1);
+        assert(list2.rbegin()->value == 0);
+
+        list2.RemoveIf([](const HookTest& e)
+        {
+            return e.value == 3;
+        });
+
+        assert(list1.GetLength() == 3);
+        assert(list2.GetHead() == &nodes[1]);
+        assert(list2.GetStats().removes == 2);
+
+        HookTest copies[3];
+        copies[0].value = 0;
+        copies[1].value = 2;
+        copies[2].value = 3;
+
+        HookList1 list3;
+
+        for (auto&& e : copies)
+        {
+            list3.InsertLast(&e);
+        }
+
+        assert(list1 == list3);
+        list1.Remove(&nodes[2]);
+        assert(list1 != list3);
+        assert(list1 >  list3);
+
+        list1.Clear();
+        list2.Clear();
+        list3.Clear();
+    })
+
+    using CompactList  = IntrusiveList<HookTest, true, MemberHook<&HookTest::hook2>, CompactHead<true>>;
+    using CompactList8 = IntrusiveList<HookTest, false, CompactHead<true>, MemberHook<&HookTest::hook2>>;
+    using CompactList4 = IntrusiveList<HookTest, true, CompactHead<true>, CompactLength<true>, MemberHook<&HookTest::hook2>>;
+
+    AKR_TEST(CompactHead,
+    {
+        static_assert(sizeof(CompactList8) == sizeof(void*));
+        static_assert(sizeof(CompactList4) <= 2 * sizeof(void*));
+        static_assert(sizeof(HookList1) == 2 * sizeof(void*) + sizeof(std::size_t));
+        static_assert(CompactList::HasCompactHead && !HookList1::HasCompactHead);
+
+        // every step is mirrored on a plain list through the other hook and both must agree
+        HookList1   plain;
+        CompactList compact;
+
+        std::vector<HookTest> nodes(48);
+
+        for (int i = 0; i < 48; i++)
+        {
+            nodes[i].value = i;
+        }
+
+        auto check = [&]
+        {
+            auto same = [](const HookTest& lhs, const HookTest& rhs)
+            {
+                return &lhs == &rhs;
+            };
+
+            assert(plain.GetLength() == compact.GetLength());
+            assert(plain.GetHead() == compact.GetHead().operator->());
+            assert(plain.GetLast() == compact.GetLast().operator->());
+            assert(std::equal(plain.begin (), plain.end (), compact.begin (), compact.end (), same));
+            assert(std::equal(plain.rbegin(), plain.rend(), compact.rbegin(), compact.rend(), same));
+        };
+
+        auto pick = [&](std::uint32_t seed) -> HookTest*
+        {
+            auto iter = compact.begin();
+
+            for (auto n = seed % compact.GetLength(); n; n--)
+            {
+                ++iter;
+            }
+
+            return iter.operator->();
+        };
+
+        std::vector<bool> linked(48);
+
+        std::uint32_t seed = 12345;
+
+        for (int step = 0; step < 2000; step++)
+        {
+            seed = seed * 1103515245 + 12345;
+
+            auto node = &nodes[(seed >> 8) % 48];
+            auto op   = (seed >> 16) % 8;
+
+            if (!linked[node->value])
+            {
+                if (compact.IsEmpty() || op < 2)
+                {
+                    plain  .InsertHead(node);
+                    compact.InsertHead(node);
+                }
+                else if (op < 4)
+                {
+                    plain  .InsertLast(node);
+                    compact.InsertLast(node);
+                }
+                else
+                {
+                    auto cur = pick(seed >> 4);
+
+                    if (op < 6)
+                    {
+                        plain  .InsertPrev(cur, node);
+                        compact.InsertPrev(cur, node);
+                    }
+                    else
+                    {
+                        plain  .InsertNext(cur, node);
+                        compact.InsertNext(cur, node);
+                    }
+                }
+            }
+            else if (op < 6)
+            {
+                plain  .Remove(node);
+                compact.Remove(node);
+            }
+            else if (op < 7)
+            {
+                auto first = pick(seed >> 4);
+                auto limit = plain.GetHead();
+
+                for (limit = first, ++limit; limit && limit->value % 3; ++limit)
+                {
+                }
+
+                plain  .EraseRange(first, limit.operator->());
+                compact.EraseRange(first, limit.operator->());
+            }
+            else
+            {
+                auto pred = [&](const HookTest& e)
+                {
+                    return (e.value + step) % 5 == 0;
+                };
+
+                plain  .RemoveIf(pred);
+                compact.RemoveIf(pred);
+            }
+
+            check();
+
+            std::fill(linked.begin(), linked.end(), false);
+
+            for (auto&& e : plain)
+            {
+                linked[e.value] = true;
+            }
+        }
+
+        std::size_t drained {};
+
+        for (auto&& e : compact.Drain())
+        {
+            plain.Remove(&e);
+
+            if (++drained == 3)
+            {
+                break;
+            }
+        }
+
+        check();
+
+        {
+            auto batch = compact.BeginBatch();
+
+            batch.RemoveLast();
+            batch.RemoveHead();
+        }
+
+        plain.RemoveLast();
+        plain.RemoveHead();
+
+        check();
+
+        plain  .Clear();
+        compact.Clear();
+
+        compact.InsertRangeLast(nodes.begin(), nodes.end());
+        plain  .InsertRangeLast(nodes.begin(), nodes.end());
+
+        check();
+
+        plain  .Clear();
+        compact.Clear();
+    })
+
+    struct OwnedTest: TrackedIntrusiveNode<OwnedTest>
+    {
+        int value {};
+    };
+
+    using OwnerList = IntrusiveList<OwnedTest, true, TrackOwner<true>>;
+
+    AKR_TEST(TrackOwner,
+    {
+        OwnerList list1;
+        OwnerList list2;
+
+        OwnedTest nodes[6];
+
+        for (int i = 0; i < 6; i++)
+        {
+            nodes[i].value = i;
+
+            (i < 3 ? list1 : list2).InsertLast(&nodes[i]);
+        }
+
+        assert( list1.Contains(&nodes[0]));
+        assert(!list1.Contains(&nodes[3]));
+        assert(OwnerList::OwnerOf(&nodes[4]) == &list2);
+
+        // routed to list2, which keeps its ends and length right
+        list1.Remove(&nodes[5]);
+        assert(list2.GetLength() == 2);
+        assert(list2.GetLast() == &nodes[4]);
+        assert(!OwnerList::OwnerOf(&nodes[5]));
+
+        list1.Remove(&nodes[5]);
+        assert(list1.GetLength() == 3);
+
+        // moved out of list2 through its owner
+        list1.InsertHead(&nodes[3]);
+        assert(list1.GetLength() == 4);
+        assert(list2.GetLength() == 1);
+        assert(list2.GetHead() == &nodes[4]);
+        assert(list1.Contains(&nodes[3]));
+
+        list1.Swap(list2);
+        assert(list2.Contains(&nodes[0]));
+        assert(list1.Contains(&nodes[4]));
+
+        auto list3 = list2.TakeAll();
+        assert(list3.Contains(&nodes[3]));
+        assert(list3.GetLength() == 4);
+
+        list3.InsertRangeLast(&nodes[5], &nodes[6]);
+        assert(list3.Contains(&nodes[5]));
+
+        list3.RemoveIf([](const OwnedTest& e)
+        {
+            return e.value % 2 == 0;
+        });
+
+        assert(!OwnerList::OwnerOf(&nodes[0]));
+        assert(list3.Contains(&nodes[1]));
+
+        list3.Clear();
+        assert(!OwnerList::OwnerOf(&nodes[1]));
+
+        list1.Clear();
+        assert(!list1.Contains(&nodes[4]));
+
+        // a batch takes nodes out of their other list as well
+        list3.InsertLast(&nodes[3]);
+        list3.InsertLast(&nodes[1]);
+        list3.InsertLast(&nodes[5]);
+
+        {
+            auto batch = list1.BeginBatch();
+
+            batch.InsertLast(&nodes[3]);
+            batch.InsertHead(&nodes[5]);
+            batch.InsertLast(&nodes[5]);
+        }
+
+        assert(list1.GetLength() == 2);
+        assert(list1.GetHead() == &nodes[3]);
+        assert(list1.Contains(&nodes[5]));
+        assert(list3.GetLength() == 1);
+        assert(list3.GetHead() == &nodes[1] && list3.GetLast() == &nodes[1]);
+        assert(std::distance(list3.begin(), list3.end()) == 1);
+
+        // ClearUnsafe() and move assignment leave no node pointing at the list
+        list3.ClearUnsafe();
+        assert(!OwnerList::OwnerOf(&nodes[1]));
+
+        list2.InsertLast(&nodes[1]);
+        list2 = std::move(list1);
+        assert(!OwnerList::OwnerOf(&nodes[1]));
+        assert(list2.Contains(&nodes[3]));
+        assert(list2.GetLength() == 2);
+
+        list3.InsertLast(&nodes[1]);
+        list3.InsertLast(&nodes[3]);
+        assert(list2.GetLength() == 1);
+        assert(std::distance(list2.begin(), list2.end()) == 1);
+
+        list2.Clear();
+        list3.Clear();
+
+        // nodes outlive a list destroyed while holding them
+        {
+            auto gone = std::make_unique<OwnerList>();
+            gone->InsertLast(&nodes[4]);
+            gone->InsertLast(&nodes[5]);
+        }
+
+        assert(!OwnerList::OwnerOf(&nodes[4]));
+        assert(!OwnerList::OwnerOf(&nodes[5]));
+
+        list3.InsertLast(&nodes[4]);
+        list3.Remove(&nodes[5]);
+        list3.InsertLast(&nodes[5]);
+        assert(list3.GetLength() == 2);
+        assert(std::distance(list3.rbegin(), list3.rend()) == 2);
+
+        list3.Clear();
+
+        // and chunks of SplitEvery() the callback leaves alone
+        {
+            OwnerList source;
+
+            for (auto&& e : nodes)
+            {
+                source.InsertLast(&e);
+            }
+
+            assert(source.SplitEvery(4, [](OwnerList&&) noexcept
+            {
+            }) == 2);
+        }
+
+        for (auto&& e : nodes)
+        {
+            assert(!OwnerList::OwnerOf(&e));
+
+            list1.InsertHead(&e);
+        }
+
+        assert(list1.GetLength() == 6);
+        assert(std::distance(list1.rbegin(), list1.rend()) == 6);
+
+        list1.Clear();
+    })
+
+    struct AutoTest: AutoUnlinkIntrusiveNode<AutoTest>
+    {
+        int value {};
+    };
+
+    using AutoList        = IntrusiveList<AutoTest>;
+    using AutoCompactList = IntrusiveList<AutoTest, true, CompactHead<true>>;
+
+    AKR_TEST(AutoUnlink,
+    {
+        static_assert(AutoList::HasAutoUnlink && AutoList::HasOwner);
+
+        AutoList list;
+
+        {
+            AutoTest a;
+            AutoTest b;
+            AutoTest c;
+
+            list.InsertLast(&a);
+            list.InsertLast(&b);
+            list.InsertLast(&c);
+
+            {
+                auto d = std::make_unique<AutoTest>();
+                d->value = 4;
+
+                list.InsertNext(&a, d.get());
+
+                auto copy = *d;
+                assert(!list.Contains(&copy));
+                assert(list.GetLength() == 4);
+            }
+
+            assert(list.GetLength() == 3);
+            assert(std::next(list.begin()) == &b);
+        }
+
+        assert(list.IsEmpty());
+        assert(list.GetLength() == 0);
+
+        auto nodes = std::make_unique<AutoTest[]>(3);
+
+        {
+            AutoCompactList compact;
+
+            for (int i = 0; i < 3; i++)
+            {
+                compact.InsertLast(&nodes[i]);
+            }
+
+            std::destroy_at(&nodes[0]);
+            std::construct_at(&nodes[0]);
+
+            assert(compact.GetLength() == 2);
+            assert(compact.GetHead() == &nodes[1]);
+            assert(compact.rbegin()->value == nodes[2].value);
+            assert(std::next(compact.rbegin()) == &nodes[1]);
+        }
+
+        assert(!AutoCompactList::OwnerOf(&nodes[1]));
+    })
+
+    // the hook sits behind a member with its own destructor, so the links are not at offset 0 of T
+    struct AutoHookTest
+    {
+        std::string name;
+
+        AutoUnlinkIntrusiveNode<AutoHookTest> hook;
+    };
+
+    using AutoHookList = IntrusiveList<AutoHookTest, true, MemberHook<&AutoHookTest::hook>, CompactHead<true>>;
+
+    AKR_TEST(AutoUnlinkMemberHook,
+    {
+        static_assert(AutoHookList::HasAutoUnlink);
+
+        AutoHookList list;
+
+        AutoHookTest first;
+        first.name = "first";
+
+        list.InsertLast(&first);
+
+        {
+            auto middle = std::make_unique<AutoHookTest>();
+            middle->name = "a name long enough to live on the heap";
+
+            AutoHookTest last;
+
+            list.InsertLast(middle.get());
+            list.InsertLast(&last);
+
+            assert(list.GetLength() == 3);
+        }
+
+        assert(list.GetLength() == 1);
+        assert(list.GetHead() == &first);
+        assert(list.GetLast() == &first);
+        assert(std::distance(list.rbegin(), list.rend()) == 1);
+
+        {
+            AutoHookTest head;
+
+            list.InsertHead(&head);
+        }
+
+        assert(list.GetHead() == &first);
+        assert(std::distance(list.begin(), list.end()) == 1);
+
+        list.Clear();
+    })
+
+    struct AutoNameTest: AutoUnlinkIntrusiveNode<AutoNameTest>
+    {
+        std::string name;
+
+        auto operator<=>(const AutoNameTest&) const = default;
+    };
+
+    constexpr auto HashName(const AutoNameTest& e) noexcept -> std::uint64_t
+    {
+        std::uint64_t hash {};
+
+        for (auto c : e.name)
+        {
+            hash = hash * 31 + static_cast<unsigned char>(c);
+        }
+
+        return hash;
+    }
+
+    using AutoNameList = IntrusiveList<AutoNameTest, true, Fingerprint<&HashName>>;
+
+    AKR_TEST(AutoUnlinkFingerprint,
+    {
+        AutoNameList list1;
+        AutoNameList list2;
+
+        AutoNameTest kept1;
+        AutoNameTest kept2;
+
+        kept1.name = "a name long enough to live on the heap";
+        kept2.name = kept1.name;
+
+        list1.InsertLast(&kept1);
+        list2.InsertLast(&kept2);
+
+        {
+            auto gone = std::make_unique<AutoNameTest>();
+            gone->name = "another name long enough to live on the heap";
+
+            list1.InsertHead(gone.get());
+            assert(list1 != list2);
+        }
+
+        // the destroyed node is not hashed again, the fingerprint is recomputed on the next read
+        assert(list1.GetLength() == 1);
+        assert(list1 == list2);
+        assert(list1.GetFingerprint() == list2.GetFingerprint());
+
+        list1.Clear();
+        list2.Clear();
+    })
+
+    struct SpliceTest: IntrusiveNode<SpliceTest>
+    {
+        int value {};
+    };
+
+    using LazyList         = IntrusiveList<SpliceTest, true, LazyLength<true>>;
+    using LazyCompactList  = IntrusiveList<SpliceTest, true, LazyLength<true>, CompactHead<true>, CompactLength<true>>;
+    using EagerList        = IntrusiveList<SpliceTest>;
+    using EagerCompactList = IntrusiveList<SpliceTest, true, CompactHead<true>>;
+
+    AKR_TEST(LazyLength,
+    {
+        static_assert(LazyList::HasLazyLength && !EagerList::HasLazyLength);
+        static_assert(sizeof(LazyCompactList) == 16);
+
+        SpliceTest nodes[8];
+
+        LazyList list1;
+        LazyList list2;
+
+        for (int i = 0; i < 8; i++)
+        {
+            nodes[i].value = i;
+
+            list1.InsertLast(&nodes[i]);
+        }
+
+        assert(list1.GetLength() == 8);
+
+        // [2, 5) moves without being counted
+        list2.Splice(nullptr, list1, &nodes[2], &nodes[5]);
+        assert(list1.GetHead() == &nodes[0]);
+        assert(std::next(list1.begin(), 2) == &nodes[5]);
+        assert(list2.GetHead() == &nodes[2]);
+        assert(list2.GetLast() == &nodes[4]);
+
+        // the counters kept going while dirty
+        list1.RemoveHead();
+        list2.InsertHead(&nodes[0]);
+
+        assert(list1.GetLength() == 4);
+        assert(list2.GetLength() == 4);
+
+        // counted splices and whole-list splices keep the cache clean
+        list1.Splice(list1.GetHead(), list2, list2.GetHead(), std::next(list2.begin(), 2), 2);
+        assert(list1.GetLength() == 6);
+        assert(list2.GetLength() == 2);
+
+        list1.Splice(nullptr, list2);
+        assert(list2.IsEmpty());
+        assert(list2.GetLength() == 0);
+        assert(list1.GetLength() == 8);
+
+        std::vector<int> values;
+
+        for (auto& e : list1)
+        {
+            values.push_back(e.value);
+        }
+
+        assert(values == std::vector<int>({ 0, 2, 1, 5, 6, 7, 3, 4 }));
+
+        // within one list the length does not change
+        list1.Splice(list1.GetHead(), list1, &nodes[3], nullptr);
+        assert(list1.GetHead() == &nodes[3]);
+        assert(list1.GetLast() == &nodes[7]);
+        assert(list1.GetLength() == 8);
+
+        // even when the whole list is cut out and put back
+        list1.Splice(nullptr, list1, list1.begin(), nullptr);
+        assert(list1.GetHead() == &nodes[3]);
+        assert(list1.GetLast() == &nodes[7]);
+        assert(list1.GetLength() == 8);
+
+        LazyCompactList compact;
+        compact.Splice(nullptr, list1, std::next(list1.begin()), &nodes[6]);
+        assert(compact.GetLast()->value == 5);
+        assert(compact.rbegin()->value == 5);
+        assert(compact.GetLength() == 5);
+        assert(list1.GetLength() == 3);
+
+        // an eager list counts the range it is given
+        EagerList eager;
+        eager.Splice(nullptr, compact, std::next(compact.begin()), nullptr);
+        assert(eager.GetLength() == 4);
+        assert(compact.GetLength() == 1);
+        assert(compact.GetHead() == compact.GetLast());
+
+        eager  .Clear();
+        compact.Clear();
+        list1  .Clear();
+    })
+
+    // The same operations run through the typed code when constant evaluated and through LinkCore at run time.
+    template<class List>
+    constexpr auto LinkCoreScript() noexcept -> int
+    {
+        SpliceTest nodes[5];
+
+        List list;
+
+        list.InsertLast(&nodes[0]);
+        list.InsertHead(&nodes[1]);
+        list.InsertNext(&nodes[0], &nodes[2]);
+        list.InsertPrev(&nodes[1], &nodes[3]);
+        list.InsertPrev(&nodes[0], &nodes[4]);
+
+        list.Remove(&nodes[3]);
+        list.Remove(&nodes[2]);
+        list.InsertHead(&nodes[2]);
+        list.Remove(&nodes[0]);
+
+        // 2 1 4, then back to front
+        int digits {};
+
+        for (auto& e : list)
+        {
+            digits = digits * 10 + static_cast<int>(&e - nodes);
+        }
+
+        for (auto iter = list.rbegin(); iter != list.rend(); ++iter)
+        {
+            digits = digits * 10 + static_cast<int>(&*iter - nodes);
+        }
+
+        list.Clear();
+
+        return digits;
+    }
+
+    AKR_TEST(LinkCore,
+    {
+        static_assert(LinkCoreScript<EagerList       >() == 214412);
+        static_assert(LinkCoreScript<EagerCompactList>() == 214412);
+
+        assert(LinkCoreScript<EagerList       >() == 214412);
+        assert(LinkCoreScript<EagerCompactList>() == 214412);
+    })
+
+    struct PrintTest: IntrusiveNode<PrintTest>
+    {
+        int value {};
+
+        auto operator<=>(const PrintTest&) const = default;
+    };
+
+    constexpr auto HashPrint(const PrintTest& e) noexcept -> std::uint64_t
+    {
+        return static_cast<std::uint64_t>(e.value);
+    }
+
+    using PrintList = IntrusiveList<PrintTest, true, Fingerprint<&HashPrint>>;
+    using PlainList = IntrusiveList<PrintTest>;
+
+    AKR_TEST(Fingerprint,
+    {
+        static_assert(PrintList::HasFingerprint && !PlainList::HasFingerprint);
+
+        PrintTest nodes1[4];
+        PrintTest nodes2[4];
+
+        PrintList list1;
+        PrintList list2;
+
+        assert(list1.GetFingerprint() == list2.GetFingerprint());
+
+        for (int i = 0; i < 4; i++)
+        {
+            nodes1[i].value = i;
+            nodes2[i].value = i;
+        }
+
+        for (int i = 0; i < 4; i++)
+        {
+            list1.InsertLast(&nodes1[i]);
+            list2.InsertHead(&nodes2[3 - i]);
+        }
+
+        // built in different orders, kept in O(1) per insert
+        assert(list1.GetFingerprint() == list2.GetFingerprint());
+        assert(list1 == list2);
+
+        // same length and values, other order
+        list2.Remove(&nodes2[1]);
+        list2.InsertLast(&nodes2[1]);
+        assert(list1.GetLength() == list2.GetLength());
+        assert(list1.GetFingerprint() != list2.GetFingerprint());
+        assert(list1 != list2);
+
+        list2.Remove(&nodes2[1]);
+        list2.InsertNext(&nodes2[0], &nodes2[1]);
+        assert(list1.GetFingerprint() == list2.GetFingerprint());
+
+        // the rest of the list does not matter for an edit in the middle
+        PrintList copy;
+        PrintTest spare1;
+        PrintTest spare2;
+
+        spare1.value = 7;
+        spare2.value = 7;
+
+        list1.InsertPrev(&nodes1[2], &spare1);
+        list2.InsertPrev(&nodes2[2], &spare2);
+        assert(list1 == list2);
+
+        // range operations mark it dirty, the next read walks once
+        copy.Splice(nullptr, list1, &nodes1[1], &nodes1[3]);
+        list2.EraseRange(&nodes2[1], &nodes2[3]);
+        assert(list1 == list2);
+        assert(copy.GetLength() == 3);
+
+        list1.Splice(&nodes1[3], copy);
+        list2.InsertPrev(&nodes2[3], &nodes2[1]);
+        list2.InsertPrev(&nodes2[3], &spare2);
+        list2.InsertPrev(&nodes2[3], &nodes2[2]);
+        assert(list1 == list2);
+        assert(copy.GetFingerprint() == PrintList().GetFingerprint());
+
+        // changed in place
+        nodes1[0].value = 9;
+        list1.RefreshFingerprint();
+        assert(list1 != list2);
+
+        nodes2[0].value = 9;
+        list2.RefreshFingerprint();
+        assert(list1 == list2);
+
+        // and against a list without one
+        PlainList plain;
+        PrintTest nodes3[5];
+
+        for (auto&& e : list1)
+        {
+            nodes3[plain.GetLength()].value = e.value;
+
+            plain.InsertLast(&nodes3[plain.GetLength()]);
+        }
+
+        assert(list1 == plain);
+
+        plain.ClearUnsafe();
+        list1.Clear();
+        list2.Clear();
+        assert(list1.GetFingerprint() == list2.GetFingerprint());
+    })
+
+    using UncountedList = IntrusiveList<PrintTest, false>;
+
+    AKR_TEST(Lockstep,
+    {
+        PrintTest nodes1[6];
+        PrintTest nodes2[6];
+        PrintTest nodes3[6];
+
+        // every pair of lengths, odd and even, with the difference anywhere or nowhere
+        for (int n = 0; n <= 6; n++)
+        {
+            for (int m = 0; m <= 6; m++)
+            {
+                for (int diff = -1; diff < m; diff++)
+                {
+                    PlainList     list1;
+                    PlainList     list2;
+                    UncountedList list3;
+
+                    for (int i = 0; i < n; i++)
+                    {
+                        nodes1[i].value = i % 3;
+
+                        list1.InsertLast(&nodes1[i]);
+                    }
+
+                    for (int i = 0; i < m; i++)
+                    {
+                        nodes2[i].value = i % 3 + (i == diff ? 2 - i % 4 : 0);
+                        nodes3[i].value = nodes2[i].value;
+
+                        list2.InsertLast(&nodes2[i]);
+                        list3.InsertLast(&nodes3[i]);
+                    }
+
+                    auto equal = std::equal(list1.begin(), list1.end(), list2.begin(), list2.end());
+                    auto order = std::lexicographical_compare_three_way(list1.begin(), list1.end(), list2.begin(), list2.end());
+
+                    assert(list1.Equal(list2) == equal);
+                    assert(list1.Equal(list3) == equal);
+                    assert(list3.Equal(list1) == equal);
+                    assert(list1.Compare3Way(list2) == order);
+                    assert(list1.Compare3Way(list3) == order);
+                    assert((list1 <=> list2) == order);
+
+                    for (int target = 0; target < 4; target++)
+                    {
+                        auto match = [target](const PrintTest& e)
+                        {
+                            return e.value == target;
+                        };
+
+                        assert(std::as_const(list2).FindIf(match) == std::find_if(std::as_const(list2).begin(), std::as_const(list2).end(), match));
+                        assert(list2.FindIf(match) == std::find_if(list2.begin(), list2.end(), match));
+                        assert(list2.CountIf(match) == static_cast<std::size_t>(std::count_if(list2.begin(), list2.end(), match)));
+                    }
+
+                    list1.Clear();
+                    list2.Clear();
+                    list3.Clear();
+                }
+            }
+        }
+    })
+
+    // values front to back, checked against the back links, the tail and the length
+    template<class List>
+    auto RelinkValues(const List& list) -> std::vector<int>
+    {
+        std::vector<int> values;
+        std::vector<int> backward;
+
+        for (auto&& e : list)
+        {
+            values.push_back(e.value);
+        }
+
+        for (auto iter = list.rbegin(); iter != list.rend(); ++iter)
+        {
+            backward.push_back(iter->value);
+        }
+
+        std::reverse(backward.begin(), backward.end());
+
+        assert(values == backward);
+        assert(values.size() == list.GetLength());
+        assert(values.empty() || list.GetLast()->value == values.back());
+
+        return values;
+    }
+
+    template<class List>
+    auto RelinkScript() -> bool
+    {
+        for (int n = 0; n <= 7; n++)
+        {
+            std::vector<int> source;
+
+            for (int i = 0; i < n; i++)
+            {
+                source.push_back(i);
+            }
+
+            // every subset of the nodes matches once
+            for (int mask = 0; mask < (1 << n); mask++)
+            {
+                auto pred = [mask](const SpliceTest& e)
+                {
+                    return (mask >> e.value & 1) != 0;
+                };
+
+                SpliceTest nodes[7];
+
+                List list;
+
+                for (int i = 0; i < n; i++)
+                {
+                    nodes[i].value = i;
+
+                    list.InsertLast(&nodes[i]);
+                }
+
+                auto bound  = list.Partition(pred);
+                auto values = RelinkValues(list);
+                auto split  = std::partition_point(values.begin(), values.end(), [mask](int value)
+                {
+                    return (mask >> value & 1) != 0;
+                });
+
+                assert(std::is_partitioned(values.begin(), values.end(), [mask](int value)
+                {
+                    return (mask >> value & 1) != 0;
+                }));
+                assert(std::is_permutation(values.begin(), values.end(), source.begin(), source.end()));
+                assert(split == values.end() ? !bound : bound->value == *split);
+
+                // back to the original order
+                list.Clear();
+
+                for (int i = 0; i < n; i++)
+                {
+                    list.InsertLast(&nodes[i]);
+                }
+
+                auto expected = source;
+
+                std::stable_partition(expected.begin(), expected.end(), [mask](int value)
+                {
+                    return (mask >> value & 1) != 0;
+                });
+
+                bound = list.StablePartition(pred);
+
+                assert(RelinkValues(list) == expected);
+                assert(bound == std::find_if_not(list.begin(), list.end(), pred));
+
+                list.Reverse();
+                std::reverse(expected.begin(), expected.end());
+
+                assert(RelinkValues(list) == expected);
+
+                list.Clear();
+            }
+
+            for (int pos = 0; pos <= n; pos++)
+            {
+                SpliceTest nodes[7];
+
+                List list;
+
+                for (int i = 0; i < n; i++)
+                {
+                    nodes[i].value = i;
+
+                    list.InsertLast(&nodes[i]);
+                }
+
+                list.Rotate(std::next(list.begin(), pos));
+
+                auto expected = source;
+
+                std::rotate(expected.begin(), expected.begin() + (pos % (n ? n : 1)), expected.end());
+
+                assert(RelinkValues(list) == expected);
+
+                list.Clear();
+            }
+        }
+
+        return true;
+    }
+
+    template<class List>
+    auto SplitScript() -> bool
+    {
+        for (int n = 0; n <= 7; n++)
+        {
+            std::vector<int> source;
+
+            for (int i = 0; i < n; i++)
+            {
+                source.push_back(i);
+            }
+
+            SpliceTest nodes[7];
+
+            List list;
+
+            for (int pos = 0; pos <= n; pos++)
+            {
+                for (int counted = 0; counted < 2; counted++)
+                {
+                    for (int i = 0; i < n; i++)
+                    {
+                        nodes[i].value = i;
+
+                        list.InsertLast(&nodes[i]);
+                    }
+
+                    auto at     = std::next(list.begin(), pos);
+                    auto suffix = counted ? list.SplitAt(at, static_cast<std::size_t>(n - pos)) : list.SplitAt(at);
+
+                    assert(RelinkValues(list  ) == std::vector<int>(source.begin()      , source.begin() + pos));
+                    assert(RelinkValues(suffix) == std::vector<int>(source.begin() + pos, source.end()        ));
+
+                    // and back
+                    list.Splice(nullptr, suffix);
+                    assert(RelinkValues(list) == source);
+
+                    if (pos < n)
+                    {
+                        auto after = list.SplitAfter(std::next(list.begin(), pos));
+
+                        assert(RelinkValues(list ) == std::vector<int>(source.begin()          , source.begin() + pos + 1));
+                        assert(RelinkValues(after) == std::vector<int>(source.begin() + pos + 1, source.end()            ));
+
+                        after.Clear();
+                    }
+
+                    list.Clear();
+                }
+            }
+
+            for (std::size_t k = 1; k <= 4; k++)
+            {
+                for (int i = 0; i < n; i++)
+                {
+                    list.InsertLast(&nodes[i]);
+                }
+
+                std::vector<int> joined;
+
+                auto chunks = list.SplitEvery(k, [&](List&& chunk)
+                {
+                    auto values = RelinkValues(chunk);
+
+                    assert(values.size() == k || joined.size() + values.size() == source.size());
+
+                    joined.insert(joined.end(), values.begin(), values.end());
+
+                    chunk.Clear();
+                });
+
+                assert(chunks == (source.size() + k - 1) / k);
+                assert(joined == source);
+                assert(list.IsEmpty() && list.GetLength() == 0);
+            }
+        }
+
+        return true;
+    }
+
+    AKR_TEST(Split,
+    {
+        assert(SplitScript<EagerList       >());
+        assert(SplitScript<EagerCompactList>());
+        assert(SplitScript<LazyList        >());
+        assert(SplitScript<LazyCompactList >());
+    })
+
+    template<class List>
+    auto SetScript() -> bool
+    {
+        auto less = [](const SpliceTest& l, const SpliceTest& r)
+        {
+            return l.value < r.value;
+        };
+
+        unsigned seed = 1;
+
+        auto random = [&seed](int n)
+        {
+            seed = seed * 1103515245 + 12345;
+
+            return static_cast<int>(seed >> 16) % n;
+        };
+
+        for (int round = 0; round < 200; round++)
+        {
+            std::vector<int> a(static_cast<std::size_t>(random(8)));
+            std::vector<int> b(static_cast<std::size_t>(random(8)));
+
+            for (auto& value : a)
+            {
+                value = random(5);
+            }
+
+            for (auto& value : b)
+            {
+                value = random(5);
+            }
+
+            std::sort(a.begin(), a.end());
+            std::sort(b.begin(), b.end());
+
+            SpliceTest nodesA[8];
+            SpliceTest nodesB[8];
+
+            List listA;
+            List listB;
+
+            auto load = [&]
+            {
+                listA.Clear();
+                listB.Clear();
+
+                for (std::size_t i = 0; i < a.size(); i++)
+                {
+                    nodesA[i].value = a[i];
+
+                    listA.InsertLast(&nodesA[i]);
+                }
+
+                for (std::size_t i = 0; i < b.size(); i++)
+                {
+                    nodesB[i].value = b[i];
+
+                    listB.InsertLast(&nodesB[i]);
+                }
+            };
+
+            std::vector<int> expected;
+            std::vector<int> rest;
+
+            load();
+
+            std::set_union(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+            std::set_intersection(b.begin(), b.end(), a.begin(), a.end(), std::back_inserter(rest));
+
+            assert(listA.MergeUnion(listB, less) == b.size() - rest.size());
+            assert(RelinkValues(listA) == expected);
+            assert(RelinkValues(listB) == rest);
+
+            load();
+            expected.clear();
+
+            std::set_intersection(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+
+            std::size_t disposed {};
+
+            assert(listA.Intersect(listB, less, [&](SpliceTest*)
+            {
+                disposed++;
+            }) == a.size() - expected.size());
+            assert(disposed == a.size() - expected.size());
+            assert(RelinkValues(listA) == expected);
+            assert(RelinkValues(listB) == b);
+
+            load();
+            expected.clear();
+
+            std::set_difference(a.begin(), a.end(), b.begin(), b.end(), std::back_inserter(expected));
+
+            assert(listA.Subtract(listB, less) == a.size() - expected.size());
+            assert(RelinkValues(listA) == expected);
+
+            load();
+            expected = a;
+            expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+            assert(listA.Unique([](const SpliceTest& l, const SpliceTest& r)
+            {
+                return l.value == r.value;
+            }) == a.size() - expected.size());
+            assert(RelinkValues(listA) == expected);
+
+            listA.Clear();
+            listB.Clear();
+        }
+
+        return true;
+    }
+
+    AKR_TEST(SetOperations,
+    {
+        assert(SetScript<EagerList      >());
+        assert(SetScript<LazyCompactList>());
+    })
+
+    AKR_TEST(Relink,
+    {
+        assert(RelinkScript<EagerList       >());
+        assert(RelinkScript<EagerCompactList>());
+        assert(RelinkScript<LazyList        >());
+
+        // the fingerprint follows a rotation in O(1)
+        PrintTest nodes[5];
+
+        PrintList list;
+
+        for (int i = 0; i < 5; i++)
+        {
+            nodes[i].value = i * i;
+
+            list.InsertLast(&nodes[i]);
+        }
+
+        list.Rotate(&nodes[3]);
+
+        auto rotated = list.GetFingerprint();
+
+        list.RefreshFingerprint();
+        assert(list.GetFingerprint() == rotated);
+
+        list.Clear();
+    })
+
+    // what a C header would declare
+    struct ListHead
+    {
+        ListHead* next;
+        ListHead* prev;
+    };
+
+    struct ListItem
+    {
+        long     key;
+        ListHead node;
+        int      value;
+    };
+
+    using ListItemView = CircularListView<ForeignHook<&ListItem::node, &ListHead::next, &ListHead::prev>>;
+
+    AKR_TEST(CircularListView,
+    {
+        ListHead head;
+
+        ListItemView view(&head);
+        view.Init();
+
+        assert(view.IsEmpty());
+        assert(view.GetLength() == 0);
+        assert(!view.GetHead());
+        assert(view.begin() == view.end());
+
+        ListItem items[4] {};
+
+        for (int i = 0; i < 4; i++)
+        {
+            items[i].value = i;
+        }
+
+        // list_add_tail done by the C side
+        items[0].node.next = &head;
+        items[0].node.prev = head.prev;
+        head.prev->next    = &items[0].node;
+        head.prev          = &items[0].node;
+
+        view.InsertLast(&items[2]);
+        view.InsertPrev(&items[2], &items[1]);
+        view.InsertNext(&items[2], &items[3]);
+
+        assert(view.GetLength() == 4);
+        assert(view.GetHead() == &items[0]);
+        assert(view.GetLast() == &items[3]);
+
+        int expect = 0;
+        for (auto&& e : view)
+        {
+            assert(e.value == expect++);
+        }
+        for (auto iter = view.rbegin(); iter != view.rend(); ++iter)
+        {
+            assert(iter->value == --expect);
+        }
+
+        // and walked by the C side again
+        expect = 0;
+        for (ListHead* iter = head.next; iter != &head; iter = iter->next)
+        {
+            auto item = reinterpret_cast<ListItem*>(reinterpret_cast<char*>(iter) - offsetof(ListItem, node));
+
+            assert(item->value == expect++);
+        }
+
+        view.Remove(&items[1]);
+        assert(items[1].node.next == &items[1].node);
+        assert(items[1].node.prev == &items[1].node);
+
+        // a removed node is self-linked, so removing it again is harmless
+        view.Remove(&items[1]);
+        assert(view.GetLength() == 3);
+
+        auto next = view.Erase(view.begin());
+        assert(next->value == 2);
+
+        view.RemoveLast();
+        assert(view.GetLength() == 1);
+        assert(view.GetHead() == &items[2]);
+
+        view.InsertHead(&items[0]);
+        assert(std::next(view.cbegin())->value == 2);
+
+        view.RemoveHead();
+        view.RemoveHead();
+        assert(view.IsEmpty());
+    })
+
+    template<class T>
+    using StatsList = IntrusiveList<T, true, RecordStats<true >>;
+
+    template<class T>
+    using NoStatsList = IntrusiveList<T, true, RecordStats<false>>;
+
+    template<class T>
+    using UncountedStatsList = IntrusiveList<T, false, RecordStats<true>>;
+
+    template<class T>
+    using LatencyList = IntrusiveList<T, true, RecordLatency<2>>;
+
+    AKR_TEST(RecordLatency,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+        };
+
+        static_assert(LatencyHistogram::GetBucket(7) == 7);
+        static_assert(LatencyHistogram::GetBucket(8) == 8);
+        static_assert(LatencyHistogram::GetLowerBound(LatencyHistogram::GetBucket(1000)) <= 1000);
+        static_assert(LatencyHistogram::GetUpperBound(LatencyHistogram::GetBucket(1000)) >= 1000);
+        static_assert(LatencyHistogram::GetBucket(~std::uint64_t {}) == LatencyHistogram::BucketCount - 1);
+        static_assert(!IntrusiveList<Test>::HasLatency);
+
+        auto latency = std::make_unique<ListLatency>();
+
+        LatencyList<Test> list;
+        list.SetLatencySink(latency.get());
+
+        Test nodes[8];
+
+        for (auto&& e : nodes)
+        {
+            list.InsertLast(&e);
+        }
+        for (auto&& e : nodes)
+        {
+            list.Remove(&e);
+        }
+
+        {
+            auto sample1 = list.SampleTraversal();
+            auto sample2 = list.SampleTraversal();
+        }
+
+        assert(latency->insert  .GetCount() == 4);
+        assert(latency->remove  .GetCount() == 4);
+        assert(latency->traverse.GetCount() == 1);
+
+        // a transfer is sampled as a remove on the source list
+        latency->Reset();
+
+        LatencyList<Test> target;
+
+        for (auto&& e : nodes)
+        {
+            list.InsertLast(&e);
+        }
+        for (auto&& e : nodes)
+        {
+            target.InsertLast(&e, list);
+        }
+
+        assert(list.IsEmpty());
+        assert(latency->remove.GetCount() == 4);
+
+        latency->Reset();
+        for (auto&& e : nodes)
+        {
+            list.InsertLast(&e);
+        }
+        for (auto&& e : nodes)
+        {
+            list.Remove(&e);
+        }
+
+        {
+            auto sample1 = list.SampleTraversal();
+            auto sample2 = list.SampleTraversal();
+        }
+
+        auto merged = std::make_unique<ListLatency>();
+        merged->Merge(*latency);
+        merged->Merge(*latency);
+
+        assert(merged->insert.GetCount() == 8);
+        assert(merged->insert.GetPercentile(100.0) >= latency->insert.GetPercentile(50.0));
+    })
 
-        assert(std::equal(list2.  begin(), list2.  end(), vec2.  begin(), vec2.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list2. rbegin(), list2. rend(), vec2. rbegin(), vec2. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list2. cbegin(), list2. cend(), vec2. cbegin(), vec2. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list2.crbegin(), list2.crend(), vec2.crbegin(), vec2.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+    AKR_TEST(RecordStats,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
 
-        vec1.clear();
-        vec2.clear();
+            Test(int value_) noexcept:
+                value { value_ }
+            {
+            }
+        };
 
-        list2.InsertNext(&v7, &v4, list1);
-        list2.InsertHead(&v3, list1);
+        static_assert(sizeof(NoStatsList<Test>) == sizeof(IntrusiveList<Test>));
 
-        assert(list1.IsEmpty() == false);
-        assert(list1.GetLength() == 5);
+        StatsList<Test> list1;
+        StatsList<Test> list2;
 
-        assert(list2.IsEmpty() == false);
-        assert(list2.GetLength() == 5);
+        static_assert(decltype(list1)::HasStats);
 
-        assert(list1 != list2);
-        assert(list1 <  list2);
-        assert(list1 <= list2);
+        auto v1 = Test(1);
+        auto v2 = Test(2);
+        auto v3 = Test(3);
 
-        vec1.push_back  (&v1);
-        vec1.push_back  (&v9);
-        vec1.push_back  (&v2);
-        vec1.push_back  (&v5);
-        vec1.push_back  (&v8);
+        list1.InsertLast(&v1);
+        list1.InsertLast(&v2);
+        list1.InsertLast(&v3);
+        list1.Remove    (&v2);
+
+        auto stats = list1.GetStats();
+        assert(stats.inserts   == 3);
+        assert(stats.removes   == 1);
+        assert(stats.splices   == 0);
+        assert(stats.highWater == 3);
+
+        list2.InsertLast(&v2);
+        list2 += std::move(list1);
+
+        stats = list2.GetStats();
+        assert(stats.inserts   == 3);
+        assert(stats.splices   == 2);
+        assert(stats.highWater == 3);
+        assert(stats.visited   == 2);
+
+        stats = list1.GetStats();
+        assert(stats.removes   == 3);
+
+        auto list3 = std::move(list2);
+        list3.Clear();
+
+        stats = list3.GetStats();
+        assert(stats.removes   == 3);
+        assert(stats.highWater == 3);
+
+        list3.InsertLast(&v1);
+        list3.InsertLast(&v2);
+        list3.ResetStats();
+
+        stats = list3.GetStats();
+        assert(stats.inserts   == 0);
+        assert(stats.highWater == 2);
+
+        // ClearUnsafe() counts the nodes it drops from the length
+        list3.ClearUnsafe();
+        assert(list3.GetStats().removes == 2);
+
+        // without a length there is nothing to take highWater from
+        UncountedStatsList<Test> uncounted;
+        uncounted.InsertLastUnlinked(&v1);
+        uncounted.InsertLastUnlinked(&v2);
+        uncounted.Remove    (&v1);
+
+        stats = uncounted.GetStats();
+        assert(stats.inserts   == 2);
+        assert(stats.removes   == 1);
+        assert(stats.highWater == 0);
+
+        uncounted.Clear();
+        assert(uncounted.GetStats().removes == 2);
+    })
 
-        vec2.push_back  (&v3);
-        vec2.push_back  (&v6);
-        vec2.push_back  (&v7);
-        vec2.push_back  (&v4);
-        vec2.push_back  (&v0);
+#ifdef  Z_AKR_NOALLOC_HH
+    AKR_TEST(NoAlloc,
+    {
+        struct Test: IntrusiveNode<Test>
+        {
+            int value {};
 
-        assert(std::equal(list1.  begin(), list1.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list1. rbegin(), list1. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list1. cbegin(), list1. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list1.crbegin(), list1.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+            auto operator<=>(const Test&) const = default;
+        };
 
-        assert(std::equal(list2.  begin(), list2.  end(), vec2.  begin(), vec2.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list2. rbegin(), list2. rend(), vec2. rbegin(), vec2. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list2. cbegin(), list2. cend(), vec2. cbegin(), vec2. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list2.crbegin(), list2.crend(), vec2.crbegin(), vec2.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+        auto latency = std::make_unique<ListLatency>();
 
-        auto list3 = std::move(list1);
+        Test       nodes [8];
+        OwnedTest  owned [2];
+        PrintTest  prints[3];
+        HookTest   hooks [3];
+        ListHead   cHead;
+        ListItem   items [3] {};
 
-        assert(list1.IsEmpty());
-        assert(list1.GetLength() == 0);
-        assert(list3.IsEmpty() == false);
-        assert(list3.GetLength() == 5);
+        {
+            NoAllocScope scope;
 
-        assert(std::equal(list3.  begin(), list3.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list3. rbegin(), list3. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list3. cbegin(), list3. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list3.crbegin(), list3.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+            IntrusiveList<Test> list1;
+            IntrusiveList<Test> list2;
 
-        IntrusiveList<Test> list4;
-        list4 = std::move(list2);
+            list1.InsertLast(&nodes[0]);
+            list1.InsertHead(&nodes[1]);
+            list1.InsertPrev(list1.GetLast(), &nodes[2]);
+            list1.InsertNext(list1.GetHead(), &nodes[3]);
 
-        assert(list2.IsEmpty());
-        assert(list2.GetLength() == 0);
-        assert(list4.IsEmpty() == false);
-        assert(list4.GetLength() == 5);
+            list2.InsertLast(&nodes[4], list1);
+            list2.InsertHead(&nodes[5]);
+            list2.InsertPrev(list2.GetLast(), &nodes[3], list1);
+            list2.InsertNext(list2.GetHead(), &nodes[2], list1);
+            list2.InsertHead(&nodes[6], list1);
 
-        assert(std::equal(list4.  begin(), list4.  end(), vec2.  begin(), vec2.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list4. rbegin(), list4. rend(), vec2. rbegin(), vec2. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list4. cbegin(), list4. cend(), vec2. cbegin(), vec2. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list4.crbegin(), list4.crend(), vec2.crbegin(), vec2.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+            for (auto&& e : list2)
+            {
+                e.value++;
+            }
+            for (auto iter = list2.rbegin(); iter != list2.rend(); ++iter)
+            {
+                iter->value++;
+            }
 
-        assert(list3 != list4);
-        assert(list3 <  list4);
-        assert(list3 <= list4);
+            [[maybe_unused]] auto equal = list1 == list2;
+            [[maybe_unused]] auto order = list1 <=> list2;
 
-        IntrusiveList<Test> list5;
-        list5 += std::move(list3);
+            list1 += std::move(list2);
 
-        assert(list3.IsEmpty());
-        assert(list3.GetLength() == 0);
-        assert(list5.IsEmpty() == false);
-        assert(list5.GetLength() == 5);
+            auto list3 = std::move(list1);
+            auto list4 = std::move(list3) + std::move(list2);
 
-        assert(std::equal(list5.  begin(), list5.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list5. rbegin(), list5. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list5. cbegin(), list5. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list5.crbegin(), list5.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+            list1.TransferLast(list4.GetHead(), list4);
+            list1.TransferHead(list4.GetHead(), list4);
+            list4.TransferPrev(list4.GetLast(), list1.GetHead(), list1);
+            list1.InsertLastUnlinked(&nodes[7]);
+            list4.TransferNext(list4.GetHead(), &nodes[7], list1);
 
-        auto list6 = std::move(list5) + std::move(list4);
+            list4.RemoveHead();
+            list4.RemoveLast();
+            list4.Remove(list4.GetHead());
 
-        assert(list4.IsEmpty());
-        assert(list4.GetLength() == 0);
-        assert(list6.IsEmpty() == false);
-        assert(list6.GetLength() == 10);
+            for (auto&& e : list4.Drain())
+            {
+                list1.InsertLastUnlinked(&e);
+            }
+            list4 += std::move(list1);
 
-        vec1.insert(vec1.end(), vec2.begin(), vec2.end());
+            list1.Swap(list4);
+            list4 = list1.TakeAll();
 
-        assert(std::equal(list6.  begin(), list6.  end(), vec1.  begin(), vec1.  end(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list6. rbegin(), list6. rend(), vec1. rbegin(), vec1. rend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list6. cbegin(), list6. cend(), vec1. cbegin(), vec1. cend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
-        assert(std::equal(list6.crbegin(), list6.crend(), vec1.crbegin(), vec1.crend(), [](auto&& e1, auto&& e2)
-                          {
-                              return e1.value == e2->value;
-                          }));
+            AtomicIntrusiveList<Test> inbox;
 
-        list5.Clear();
-        assert(list5.IsEmpty());
-        assert(list5.GetLength() == 0);
+            for (auto&& e : list4.Drain())
+            {
+                inbox.Push(&e);
+            }
+            list4 = inbox.TakeAll();
 
-        list6.Clear();
-        assert(list6.IsEmpty());
-        assert(list6.GetLength() == 0);
+            list4.Clear();
+            list4.ClearAndDispose([](Test*)
+            {
+            });
+            list4.ClearUnsafe();
 
-        vec1.clear();
-        vec2.clear();
+            StatsList<Test> list5;
+            list5.InsertLast(&nodes[7]);
+            list5.RemoveLast();
+            [[maybe_unused]] auto stats = list5.GetStats();
+
+            LatencyList<Test> list6;
+            list6.SetLatencySink(latency.get());
+            list6.InsertLast(&nodes[7]);
+            list6.RemoveLast();
+            [[maybe_unused]] auto sample = list6.SampleTraversal();
+
+            for (int i = 0; i < 8; i++)
+            {
+                nodes[i].value = i / 2;
+            }
+
+            IntrusiveList<Test> list7;
+            IntrusiveList<Test> list8;
+
+            list7.InsertRangeLast(nodes, nodes + 6);
+            list8.InsertLast(&nodes[6]);
+            list8.InsertLast(&nodes[7]);
+
+            auto chainHead = list8.GetHead();
+            auto chainLast = list8.GetLast();
+            list8.ClearUnsafe();
+            list7.AdoptChain(chainHead, chainLast, 2);
+
+            {
+                auto batch = list7.BeginBatch();
+                batch.RemoveLast();
+                batch.InsertHead(&nodes[7]);
+            }
+
+            list8.Splice(nullptr, list7, list7.GetHead(), std::next(list7.begin(), 3));
+            list8.Splice(list8.GetHead(), list7);
+            list7.Splice(nullptr, list8, list8.GetHead(), nullptr, 8);
+
+            list7.Reverse();
+            list7.Rotate(std::next(list7.begin(), 2));
+            list7.Partition([](const Test& e)
+            {
+                return e.value % 2 == 0;
+            });
+            list7.StablePartition([](const Test& e)
+            {
+                return e.value % 2 != 0;
+            });
+
+            list8 = list7.SplitAt(std::next(list7.begin(), 4));
+            list8.SplitEvery(3, [&](IntrusiveList<Test>&& chunk)
+            {
+                list7 += std::move(chunk);
+            });
+            list8 = list7.SplitAfter(list7.GetHead());
+            list7 += std::move(list8);
+
+            // back in order for the sorted operations: 0 0 1 1 2 2 | 3 3
+            list7.Clear();
+            list7.InsertRangeLast(nodes, nodes + 6);
+            list8.InsertRangeLast(nodes + 6, nodes + 8);
+
+            auto less = [](const Test& e1, const Test& e2)
+            {
+                return e1.value < e2.value;
+            };
+
+            list7.Unique([](const Test& e1, const Test& e2)
+            {
+                return e1.value == e2.value;
+            });
+            list8.InsertHead(&nodes[1]);
+            list7.MergeUnion(list8, less);
+            list7.Intersect(list8, less);
+            list7.Subtract (list8, less);
+
+            list7.Clear();
+            list8.Clear();
+
+            // erase, remove and search paths: 0 0 1 1 2 2 3 3
+            list7.InsertRangeLast(nodes, nodes + 8);
+
+            [[maybe_unused]] auto found = list7.FindIf([](const Test& e)
+            {
+                return e.value == 3;
+            });
+            [[maybe_unused]] auto count = list7.CountIf([](const Test& e)
+            {
+                return e.value % 2 == 0;
+            });
+
+            list7.Erase(list7.GetHead());
+            list7.EraseRange(list7.GetHead(), std::next(list7.begin(), 2));
+            list7.RemoveIf([](const Test& e)
+            {
+                return e.value == 2;
+            });
+            list7.RemoveIfAndDispose([](const Test& e)
+            {
+                return e.value == 3;
+            },
+            [](Test*)
+            {
+            });
+            list7.Clear();
+
+            // the other configurations: owner tracking, fingerprint, compact head, member hooks, C-owned lists
+            OwnerList owners1;
+            OwnerList owners2;
+
+            owners1.InsertLast(&owned[0]);
+            owners1.InsertLast(&owned[1]);
+            owners2.InsertLast(&owned[1]);
+            owners2.InsertHead(&owned[0]);
+            owners1.Remove(&owned[0]);
+            [[maybe_unused]] auto owns = owners2.Contains(&owned[1]);
+            owners1 += std::move(owners2);
+            owners1.Clear();
+
+            PrintList printed1;
+            PrintList printed2;
+
+            printed1.InsertLast(&prints[0]);
+            printed1.InsertLast(&prints[1]);
+            printed2.InsertLast(&prints[2]);
+            prints[2].value = 1;
+            printed2.RefreshFingerprint();
+            [[maybe_unused]] auto same = printed1 == printed2;
+            printed1.Remove(&prints[0]);
+            printed1 += std::move(printed2);
+            printed1.Clear();
+
+            CompactList  compact1;
+            CompactList4 compact2;
+            HookList1    hooked;
+
+            compact1.InsertLast(&hooks[0]);
+            compact1.InsertHead(&hooks[1]);
+            compact1.Reverse();
+            compact1.Remove(&hooks[0]);
+            compact2.InsertLast(&hooks[2]);
+            compact2.InsertLast(&hooks[0]);
+            compact2.RemoveHead();
+            hooked.InsertLast(&hooks[0]);
+            hooked.InsertLast(&hooks[1]);
+            hooked.Erase(hooked.GetHead());
+            compact1.Clear();
+            compact2.Clear();
+            hooked.Clear();
+
+            ListItemView view(&cHead);
+            view.Init();
+            view.InsertLast(&items[0]);
+            view.InsertHead(&items[1]);
+            view.InsertNext(&items[1], &items[2]);
+            for (auto&& e : view)
+            {
+                e.value++;
+            }
+            view.Remove(&items[2]);
+            view.Erase(view.begin());
+            view.RemoveLast();
+        }
+
+        static Test* escape {};
+
+        AllocationCounter counter;
+        escape = new Test();
+        assert(counter.GetAllocations() == 1);
+        delete escape;
+
+        // over-aligned types go through the align_val_t overloads
+        struct alignas(64) Wide
+        {
+            char bytes[64] {};
+        };
+
+        auto wide = new Wide();
+        assert(counter.GetAllocations() == 2);
+        assert(reinterpret_cast<std::uintptr_t>(wide) % alignof(Wide) == 0);
+        delete wide;
+
+        auto wides = new Wide[3];
+        assert(counter.GetAllocations() == 3);
+        delete[] wides;
     })
+#endif//Z_AKR_NOALLOC_HH
 }
 #endif//D_AKR_TEST
 
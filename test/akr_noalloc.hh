@@ -0,0 +1,221 @@
+#pragma once
+#ifndef Z_AKR_NOALLOC_HH
+#define Z_AKR_NOALLOC_HH
+
+#include <cassert>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Per-thread allocation tracking for tests and benchmarks.
+// Define D_AKR_NOALLOC in exactly one translation unit to install the replacement allocation functions.
+namespace akr::test
+{
+    struct AllocationCounter
+    {
+        private:
+        static inline thread_local std::size_t  depth       {};
+        static inline thread_local std::size_t  allocations {};
+
+        std::size_t start {};
+
+        public:
+        AllocationCounter() noexcept:
+            start { allocations }
+        {
+            depth++;
+        }
+
+        AllocationCounter(const AllocationCounter&) = delete;
+
+        ~AllocationCounter()
+        {
+            depth--;
+        }
+
+        public:
+        auto GetAllocations() const noexcept -> std::size_t
+        {
+            return allocations - start;
+        }
+
+        public:
+        static void OnAllocate() noexcept
+        {
+            if (depth)
+            {
+                allocations++;
+            }
+        }
+    };
+
+    // Fails (assert) if the current thread allocates anywhere inside the scope.
+    struct NoAllocScope
+    {
+        private:
+        AllocationCounter counter;
+
+        public:
+        NoAllocScope() = default;
+
+        ~NoAllocScope()
+        {
+            assert(counter.GetAllocations() == 0);
+        }
+    };
+}
+
+#ifdef  D_AKR_NOALLOC
+#if defined(__GNUC__) && !defined(__clang__)
+// the replacements pair malloc with free themselves, GCC only sees new matched with free after inlining
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// glibc lets the executable interpose malloc itself, which also catches C code and std::malloc.
+// Sanitizers own malloc, so only operator new is replaced under them.
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define U_AKR_NOALLOC_MALLOC(AKR_SIZE) __libc_malloc(AKR_SIZE)
+#define U_AKR_NOALLOC_FREE(AKR_PTR)    __libc_free(AKR_PTR)
+
+extern "C"
+{
+    void* __libc_malloc (std::size_t);
+    void* __libc_calloc (std::size_t, std::size_t);
+    void* __libc_realloc(void*, std::size_t);
+    void  __libc_free   (void*);
+
+    void* malloc (std::size_t size)
+    {
+        akr::test::AllocationCounter::OnAllocate();
+
+        return __libc_malloc(size);
+    }
+
+    void* calloc (std::size_t count, std::size_t size)
+    {
+        akr::test::AllocationCounter::OnAllocate();
+
+        return __libc_calloc(count, size);
+    }
+
+    void* realloc(void* ptr, std::size_t size)
+    {
+        akr::test::AllocationCounter::OnAllocate();
+
+        return __libc_realloc(ptr, size);
+    }
+}
+#else
+#define U_AKR_NOALLOC_MALLOC(AKR_SIZE) std::malloc(AKR_SIZE)
+#define U_AKR_NOALLOC_FREE(AKR_PTR)    std::free(AKR_PTR)
+#endif
+
+// over-aligned new (align_val_t) gets its own allocator, aligned_alloc wants a multiple of the alignment
+#ifdef  _MSC_VER
+#define U_AKR_NOALLOC_ALIGNED_MALLOC(AKR_SIZE, AKR_ALIGN) _aligned_malloc(AKR_SIZE, AKR_ALIGN)
+#define U_AKR_NOALLOC_ALIGNED_FREE(AKR_PTR)               _aligned_free(AKR_PTR)
+#else
+#define U_AKR_NOALLOC_ALIGNED_MALLOC(AKR_SIZE, AKR_ALIGN) std::aligned_alloc(AKR_ALIGN, ((AKR_SIZE) + (AKR_ALIGN) - 1) / (AKR_ALIGN) * (AKR_ALIGN))
+#define U_AKR_NOALLOC_ALIGNED_FREE(AKR_PTR)               U_AKR_NOALLOC_FREE(AKR_PTR)
+#endif
+
+void* operator new  (std::size_t size)
+{
+    akr::test::AllocationCounter::OnAllocate();
+
+    if (auto ptr = U_AKR_NOALLOC_MALLOC(size ? size : 1))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new  (std::size_t size, const std::nothrow_t&) noexcept
+{
+    akr::test::AllocationCounter::OnAllocate();
+
+    return U_AKR_NOALLOC_MALLOC(size ? size : 1);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void* operator new  (std::size_t size, std::align_val_t align)
+{
+    akr::test::AllocationCounter::OnAllocate();
+
+    if (auto ptr = U_AKR_NOALLOC_ALIGNED_MALLOC(size ? size : 1, static_cast<std::size_t>(align)))
+    {
+        return ptr;
+    }
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size, std::align_val_t align)
+{
+    return operator new(size, align);
+}
+
+void* operator new  (std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept
+{
+    akr::test::AllocationCounter::OnAllocate();
+
+    return U_AKR_NOALLOC_ALIGNED_MALLOC(size ? size : 1, static_cast<std::size_t>(align));
+}
+
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t& tag) noexcept
+{
+    return operator new(size, align, tag);
+}
+
+void  operator delete  (void* ptr) noexcept
+{
+    U_AKR_NOALLOC_FREE(ptr);
+}
+
+void  operator delete[](void* ptr) noexcept
+{
+    operator delete(ptr);
+}
+
+void  operator delete  (void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+void  operator delete[](void* ptr, std::size_t) noexcept
+{
+    operator delete(ptr);
+}
+
+void  operator delete  (void* ptr, std::align_val_t) noexcept
+{
+    U_AKR_NOALLOC_ALIGNED_FREE(ptr);
+}
+
+void  operator delete[](void* ptr, std::align_val_t align) noexcept
+{
+    operator delete(ptr, align);
+}
+
+void  operator delete  (void* ptr, std::size_t, std::align_val_t align) noexcept
+{
+    operator delete(ptr, align);
+}
+
+void  operator delete[](void* ptr, std::size_t, std::align_val_t align) noexcept
+{
+    operator delete(ptr, align);
+}
+#endif//D_AKR_NOALLOC
+
+#endif//Z_AKR_NOALLOC_HH
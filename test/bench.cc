@@ -0,0 +1,279 @@
+#define D_AKR_NOALLOC
+#include "akr_noalloc.hh"
+
+#include "..\intrusivelist.hh"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    struct Test: akr::IntrusiveNode<Test>
+    {
+        int value {};
+
+        // a hand-written singly linked chain, the baseline for traversal
+        Test* raw {};
+    };
+
+    template<class F>
+    void Bench(const char* name, F&& func)
+    {
+        auto start = std::chrono::steady_clock::now();
+
+        {
+            // the list operations under measurement must not allocate
+            akr::test::NoAllocScope scope;
+
+            func();
+        }
+
+        auto stop  = std::chrono::steady_clock::now();
+
+        std::printf("%-32s %10.3f ms\n", name, std::chrono::duration<double, std::milli>(stop - start).count());
+    }
+
+    template<class List>
+    void Sink(const List& list)
+    {
+        // keeps the loads alive and checks the result
+        if (std::distance(list.begin(), list.end()) != static_cast<std::ptrdiff_t>(list.GetLength()))
+        {
+            std::puts("length mismatch");
+        }
+    }
+}
+
+int main()
+{
+    constexpr std::size_t Count = 10'000'000;
+
+    auto nodes = std::make_unique<Test[]>(Count);
+
+    std::vector<Test*> ptrs;
+    ptrs.reserve(Count);
+
+    for (std::size_t i = 0; i < Count; i++)
+    {
+        ptrs.push_back(&nodes[i]);
+    }
+
+    // initial load of 10M objects
+    {
+        akr::IntrusiveList<Test> list;
+
+        Bench("InsertLast x 10M", [&]
+        {
+            for (std::size_t i = 0; i < Count; i++)
+            {
+                list.InsertLast(&nodes[i]);
+            }
+        });
+
+        Sink(list);
+        list.ClearUnsafe();
+    }
+    {
+        akr::IntrusiveList<Test> list;
+
+        Bench("InsertLastUnlinked x 10M", [&]
+        {
+            for (std::size_t i = 0; i < Count; i++)
+            {
+                list.InsertLastUnlinked(&nodes[i]);
+            }
+        });
+
+        Sink(list);
+        list.ClearUnsafe();
+    }
+    {
+        akr::IntrusiveList<Test> list;
+
+        Bench("InsertRangeLast (objects) 10M", [&]
+        {
+            list.InsertRangeLast(nodes.get(), nodes.get() + Count);
+        });
+
+        Sink(list);
+        list.ClearUnsafe();
+    }
+    {
+        akr::IntrusiveList<Test> list;
+
+        Bench("InsertRangeLast (pointers) 10M", [&]
+        {
+            list.InsertRangeLast(ptrs.begin(), ptrs.end());
+        });
+
+        Sink(list);
+        list.ClearUnsafe();
+    }
+    {
+        akr::IntrusiveList<Test> list;
+        akr::IntrusiveList<Test> chain;
+
+        chain.InsertRangeLast(nodes.get(), nodes.get() + Count);
+
+        auto chainHead = chain.GetHead();
+        auto chainLast = chain.GetLast();
+        chain.ClearUnsafe();
+
+        Bench("AdoptChain 10M", [&]
+        {
+            list.AdoptChain(chainHead, chainLast, Count);
+        });
+
+        Sink(list);
+        list.ClearUnsafe();
+    }
+
+    // traversal, also meant to be built at -O0 (build_bench_debug.bat) where the iterator plumbing
+    // must not cost more than a raw pointer loop
+    {
+        akr::IntrusiveList<Test> list;
+
+        list.InsertRangeLast(nodes.get(), nodes.get() + Count);
+
+        for (std::size_t i = 0; i + 1 < Count; i++)
+        {
+            nodes[i].raw = &nodes[i + 1];
+        }
+
+        long long sum {};
+
+        Bench("raw pointer loop 10M", [&]
+        {
+            for (Test* iter = &nodes[0]; iter; iter = iter->raw)
+            {
+                sum += iter->value;
+            }
+        });
+
+        Bench("range-for 10M", [&]
+        {
+            for (auto& e : list)
+            {
+                sum += e.value;
+            }
+        });
+
+        Bench("reverse iteration 10M", [&]
+        {
+            for (auto iter = list.rbegin(); iter != list.rend(); ++iter)
+            {
+                sum += iter->value;
+            }
+        });
+
+        Bench("std::find_if 10M", [&]
+        {
+            sum += std::find_if(list.begin(), list.end(), [](const Test& e)
+            {
+                return e.value < 0;
+            }) != list.end();
+        });
+
+        if (sum)
+        {
+            std::puts("unexpected sum");
+        }
+
+        Sink(list);
+        list.ClearUnsafe();
+    }
+
+    // two lists linked in a random order over 160 MB each, every step is a cache miss: std:: algorithms
+    // chase one chain at a time, the list's own ones keep several in flight
+    {
+        constexpr std::size_t Half = Count / 2;
+
+        std::vector<std::size_t> order(Half);
+        std::iota(order.begin(), order.end(), std::size_t());
+        std::shuffle(order.begin(), order.end(), std::mt19937_64(42));
+
+        akr::IntrusiveList<Test> list1;
+        akr::IntrusiveList<Test> list2;
+
+        for (std::size_t i = 0; i < Half; i++)
+        {
+            nodes[order[i]       ].value = static_cast<int>(i % 1000);
+            nodes[order[i] + Half].value = static_cast<int>(i % 1000);
+
+            list1.InsertLast(&nodes[order[i]       ]);
+            list2.InsertLast(&nodes[order[i] + Half]);
+        }
+
+        auto equal = [](const Test& l, const Test& r)
+        {
+            return l.value == r.value;
+        };
+
+        auto compare = [](const Test& l, const Test& r)
+        {
+            return l.value <=> r.value;
+        };
+
+        auto missing = [](const Test& e)
+        {
+            return e.value < 0;
+        };
+
+        long long sum {};
+
+        Bench("std::equal (scattered) 2x5M", [&]
+        {
+            sum += std::equal(list1.begin(), list1.end(), list2.begin(), list2.end(), equal);
+        });
+
+        Bench("Equal (scattered) 2x5M", [&]
+        {
+            sum += list1.Equal(list2, equal);
+        });
+
+        Bench("std::lex..three_way (scattered)", [&]
+        {
+            sum += std::lexicographical_compare_three_way(list1.begin(), list1.end(), list2.begin(), list2.end(), compare) == 0;
+        });
+
+        Bench("Compare3Way (scattered) 2x5M", [&]
+        {
+            sum += list1.Compare3Way(list2, compare) == 0;
+        });
+
+        Bench("std::find_if (scattered) 5M", [&]
+        {
+            sum += std::find_if(list1.begin(), list1.end(), missing) != list1.end();
+        });
+
+        Bench("FindIf (scattered) 5M", [&]
+        {
+            sum += list1.FindIf(missing) != list1.end();
+        });
+
+        Bench("std::count_if (scattered) 5M", [&]
+        {
+            sum += std::count_if(list1.begin(), list1.end(), missing);
+        });
+
+        Bench("CountIf (scattered) 5M", [&]
+        {
+            sum += static_cast<long long>(list1.CountIf(missing));
+        });
+
+        if (sum != 4)
+        {
+            std::puts("unexpected sum");
+        }
+
+        Sink(list1);
+        Sink(list2);
+        list1.ClearUnsafe();
+        list2.ClearUnsafe();
+    }
+}
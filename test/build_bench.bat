@@ -0,0 +1 @@
+%1 "bench.cc" -o"./out/bench%1%2.exe" -Wall -Wextra -std="c++2b" -O2 %2
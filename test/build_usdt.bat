@@ -0,0 +1 @@
+%1 "main.cc" -o"./out/main_usdt%1%2.exe" -Wall -Wextra -std="c++2b" -DD_AKR_USDT %2
@@ -1,6 +1,11 @@
 #define D_AKR_TEST
+#define D_AKR_STATS
+#define D_AKR_ATOMIC_LIST
 #include "akr_test.hh"
 
+#define D_AKR_NOALLOC
+#include "akr_noalloc.hh"
+
 #include "..\intrusivelist.hh"
 
 #include <cstdio>